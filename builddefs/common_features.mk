@@ -585,6 +585,12 @@ ifneq ($(strip $(VARIABLE_TRACE)),no)
     endif
 endif
 
+ifeq ($(strip $(IDLE_SCHEDULER_ENABLE)), yes)
+    ifneq ("$(wildcard $(PLATFORM_COMMON_DIR)/idle_scheduler.c)","")
+        SRC += $(PLATFORM_COMMON_DIR)/idle_scheduler.c
+    endif
+endif
+
 ifeq ($(strip $(SLEEP_LED_ENABLE)), yes)
     SRC += $(PLATFORM_COMMON_DIR)/sleep_led.c
     OPT_DEFS += -DSLEEP_LED_ENABLE
@@ -682,7 +688,8 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
     # Determine which (if any) transport files are required
     ifneq ($(strip $(SPLIT_TRANSPORT)), custom)
         QUANTUM_SRC += $(QUANTUM_DIR)/split_common/transport.c \
-                       $(QUANTUM_DIR)/split_common/transactions.c
+                       $(QUANTUM_DIR)/split_common/transactions.c \
+                       $(QUANTUM_DIR)/split_common/link_stats.c
 
         OPT_DEFS += -DSPLIT_COMMON_TRANSACTIONS
 
@@ -6,6 +6,17 @@
 #include "eeprom_driver.h"
 #include "wear_leveling.h"
 
+#ifdef WEAR_LEVELING_DEFERRED_WRITES
+#    include "timer.h"
+
+// Deferred writes are flushed once no further writes have happened for this long
+#    ifndef WEAR_LEVELING_DEFERRED_WRITES_FLUSH_DELAY
+#        define WEAR_LEVELING_DEFERRED_WRITES_FLUSH_DELAY 1000
+#    endif
+
+static uint32_t last_write;
+#endif
+
 void eeprom_driver_init(void) {
     wear_leveling_init();
 }
@@ -26,4 +37,19 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
     wear_leveling_write((uint32_t)addr, buf, len);
+#ifdef WEAR_LEVELING_DEFERRED_WRITES
+    last_write = timer_read32();
+#endif
+}
+
+#ifdef WEAR_LEVELING_DEFERRED_WRITES
+void eeprom_driver_flush(void) {
+    wear_leveling_flush();
+}
+
+void eeprom_driver_task(void) {
+    if (wear_leveling_flush_pending() && timer_elapsed32(last_write) >= WEAR_LEVELING_DEFERRED_WRITES_FLUSH_DELAY) {
+        wear_leveling_flush();
+    }
 }
+#endif
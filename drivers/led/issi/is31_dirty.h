@@ -0,0 +1,58 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Dirty tracking shared by the ISSI drivers. Each bit covers a group of
+// IS31_DIRTY_GROUP_SIZE consecutive registers, so changing a handful of LEDs
+// only retransmits the spans around them instead of the whole PWM page.
+// A single is31_dirty_t can track pages of up to 256 registers.
+
+#define IS31_DIRTY_GROUP_SIZE 8
+
+typedef uint32_t is31_dirty_t;
+
+// Returned by value rather than set through a pointer, as the driver buffers are packed.
+static inline is31_dirty_t is31_dirty_bit(uint16_t reg) {
+    return (is31_dirty_t)1 << (reg / IS31_DIRTY_GROUP_SIZE);
+}
+
+static inline bool is31_dirty_test(is31_dirty_t dirty, uint16_t reg) {
+    return dirty & is31_dirty_bit(reg);
+}
+
+/**
+ * \brief Find the next span of dirty registers, starting the search at `*reg`.
+ *
+ * Consecutive dirty groups are merged into one span of at most `max_length`
+ * registers, which never extends past the end of the `count` register page.
+ *
+ * \return The length of the span, whose first register is stored in `*reg`,
+ *         or 0 once there are no more dirty registers.
+ */
+static inline uint8_t is31_dirty_next_span(is31_dirty_t dirty, uint8_t *reg, uint8_t count, uint8_t max_length) {
+    uint16_t start = *reg;
+    while (start < count && !is31_dirty_test(dirty, start)) {
+        start = (start / IS31_DIRTY_GROUP_SIZE + 1) * IS31_DIRTY_GROUP_SIZE;
+    }
+    if (start >= count) {
+        return 0;
+    }
+
+    uint16_t end = start;
+    while (end < count && end - start < max_length && is31_dirty_test(dirty, end)) {
+        end = (end / IS31_DIRTY_GROUP_SIZE + 1) * IS31_DIRTY_GROUP_SIZE;
+    }
+    if (end > count) {
+        end = count;
+    }
+    if (end - start > max_length) {
+        end = start + max_length;
+    }
+
+    *reg = start;
+    return end - start;
+}
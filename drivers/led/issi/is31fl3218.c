@@ -16,6 +16,7 @@
 
 #include "is31fl3218.h"
 #include "i2c_master.h"
+#include "is31_dirty.h"
 #include "gpio.h"
 
 #define IS31FL3218_PWM_REGISTER_COUNT 18
@@ -30,16 +31,16 @@
 #endif
 
 typedef struct is31fl3218_driver_t {
-    uint8_t pwm_buffer[IS31FL3218_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t led_control_buffer[IS31FL3218_LED_CONTROL_REGISTER_COUNT];
-    bool    led_control_buffer_dirty;
+    uint8_t      pwm_buffer[IS31FL3218_PWM_REGISTER_COUNT];
+    is31_dirty_t pwm_buffer_dirty;
+    uint8_t      led_control_buffer[IS31FL3218_LED_CONTROL_REGISTER_COUNT];
+    bool         led_control_buffer_dirty;
 } PACKED is31fl3218_driver_t;
 
 // IS31FL3218 has 18 PWM outputs and a fixed I2C address, so no chaining.
 is31fl3218_driver_t driver_buffers = {
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = 0,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 };
@@ -54,14 +55,23 @@ void is31fl3218_write_register(uint8_t reg, uint8_t data) {
 #endif
 }
 
-void is31fl3218_write_pwm_buffer(void) {
+bool is31fl3218_write_pwm_buffer(void) {
+    // Transmit the dirty PWM registers in transfers of up to 18 bytes.
+    bool    success = true;
+    uint8_t length;
+    for (uint8_t i = 0; (length = is31_dirty_next_span(driver_buffers.pwm_buffer_dirty, &i, IS31FL3218_PWM_REGISTER_COUNT, 18)) > 0; i += length) {
+        i2c_status_t status = i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM + i, driver_buffers.pwm_buffer + i, length, IS31FL3218_I2C_TIMEOUT);
 #if IS31FL3218_I2C_PERSISTENCE > 0
-    for (uint8_t i = 0; i < IS31FL3218_I2C_PERSISTENCE; i++) {
-        if (i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM, driver_buffers.pwm_buffer, 18, IS31FL3218_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-    }
-#else
-    i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM, driver_buffers.pwm_buffer, 18, IS31FL3218_I2C_TIMEOUT);
+        for (uint8_t j = 1; j < IS31FL3218_I2C_PERSISTENCE && status != I2C_STATUS_SUCCESS; j++) {
+            status = i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM + i, driver_buffers.pwm_buffer + i, length, IS31FL3218_I2C_TIMEOUT);
+        }
 #endif
+        if (status != I2C_STATUS_SUCCESS) {
+            success = false;
+        }
+    }
+
+    return success;
 }
 
 void is31fl3218_init(void) {
@@ -111,7 +121,9 @@ void is31fl3218_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         driver_buffers.pwm_buffer[led.r] = red;
         driver_buffers.pwm_buffer[led.g] = green;
         driver_buffers.pwm_buffer[led.b] = blue;
-        driver_buffers.pwm_buffer_dirty  = true;
+        driver_buffers.pwm_buffer_dirty |= is31_dirty_bit(led.r);
+        driver_buffers.pwm_buffer_dirty |= is31_dirty_bit(led.g);
+        driver_buffers.pwm_buffer_dirty |= is31_dirty_bit(led.b);
     }
 }
 
@@ -153,11 +165,13 @@ void is31fl3218_set_led_control_register(uint8_t index, bool red, bool green, bo
 
 void is31fl3218_update_pwm_buffers(void) {
     if (driver_buffers.pwm_buffer_dirty) {
-        is31fl3218_write_pwm_buffer();
+        bool success = is31fl3218_write_pwm_buffer();
         // Load PWM registers and LED Control register data
         is31fl3218_write_register(IS31FL3218_REG_UPDATE, 0x01);
 
-        driver_buffers.pwm_buffer_dirty = false;
+        if (success) {
+            driver_buffers.pwm_buffer_dirty = 0;
+        }
     }
 }
 
@@ -3,6 +3,7 @@
 
 #include "is31fl3236-mono.h"
 #include "i2c_master.h"
+#include "is31_dirty.h"
 #include "gpio.h"
 
 #define IS31FL3236_PWM_REGISTER_COUNT 36
@@ -34,15 +35,15 @@ const uint8_t i2c_addresses[IS31FL3236_DRIVER_COUNT] = {
 };
 
 typedef struct is31fl3236_driver_t {
-    uint8_t pwm_buffer[IS31FL3236_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t led_control_buffer[IS31FL3236_LED_CONTROL_REGISTER_COUNT];
-    bool    led_control_buffer_dirty;
+    uint8_t      pwm_buffer[IS31FL3236_PWM_REGISTER_COUNT];
+    is31_dirty_t pwm_buffer_dirty;
+    uint8_t      led_control_buffer[IS31FL3236_LED_CONTROL_REGISTER_COUNT];
+    bool         led_control_buffer_dirty;
 } PACKED is31fl3236_driver_t;
 
 is31fl3236_driver_t driver_buffers[IS31FL3236_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = 0,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
@@ -57,14 +58,23 @@ void is31fl3236_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 #endif
 }
 
-void is31fl3236_write_pwm_buffer(uint8_t index) {
+bool is31fl3236_write_pwm_buffer(uint8_t index) {
+    // Transmit the dirty PWM registers in transfers of up to 36 bytes.
+    bool    success = true;
+    uint8_t length;
+    for (uint8_t i = 0; (length = is31_dirty_next_span(driver_buffers[index].pwm_buffer_dirty, &i, IS31FL3236_PWM_REGISTER_COUNT, 36)) > 0; i += length) {
+        i2c_status_t status = i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3236_I2C_TIMEOUT);
 #if IS31FL3236_I2C_PERSISTENCE > 0
-    for (uint8_t i = 0; i < IS31FL3236_I2C_PERSISTENCE; i++) {
-        if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM, driver_buffers[index].pwm_buffer, 36, IS31FL3236_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-    }
-#else
-    i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM, driver_buffers[index].pwm_buffer, 36, IS31FL3236_I2C_TIMEOUT);
+        for (uint8_t j = 1; j < IS31FL3236_I2C_PERSISTENCE && status != I2C_STATUS_SUCCESS; j++) {
+            status = i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3236_I2C_TIMEOUT);
+        }
 #endif
+        if (status != I2C_STATUS_SUCCESS) {
+            success = false;
+        }
+    }
+
+    return success;
 }
 
 void is31fl3236_init_drivers(void) {
@@ -123,7 +133,7 @@ void is31fl3236_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= is31_dirty_bit(led.v);
     }
 }
 
@@ -143,11 +153,13 @@ void is31fl3236_set_led_control_register(uint8_t index, bool value) {
 
 void is31fl3236_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3236_write_pwm_buffer(index);
+        bool success = is31fl3236_write_pwm_buffer(index);
         // Load PWM registers and LED Control register data
         is31fl3236_write_register(index, IS31FL3236_REG_UPDATE, 0x01);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        if (success) {
+            driver_buffers[index].pwm_buffer_dirty = 0;
+        }
     }
 }
 
@@ -18,6 +18,7 @@
 
 #include "is31fl3729-mono.h"
 #include "i2c_master.h"
+#include "is31_dirty.h"
 #include "gpio.h"
 #include "wait.h"
 
@@ -80,15 +81,15 @@ const uint8_t i2c_addresses[IS31FL3729_DRIVER_COUNT] = {
 // These buffers match the PWM & scaling registers.
 // Storing them like this is optimal for I2C transfers to the registers.
 typedef struct is31fl3729_driver_t {
-    uint8_t pwm_buffer[IS31FL3729_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t scaling_buffer[IS31FL3729_SCALING_REGISTER_COUNT];
-    bool    scaling_buffer_dirty;
+    uint8_t      pwm_buffer[IS31FL3729_PWM_REGISTER_COUNT];
+    is31_dirty_t pwm_buffer_dirty;
+    uint8_t      scaling_buffer[IS31FL3729_SCALING_REGISTER_COUNT];
+    bool         scaling_buffer_dirty;
 } PACKED is31fl3729_driver_t;
 
 is31fl3729_driver_t driver_buffers[IS31FL3729_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = 0,
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
 }};
@@ -103,19 +104,25 @@ void is31fl3729_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 #endif
 }
 
-void is31fl3729_write_pwm_buffer(uint8_t index) {
-    // Transmit PWM registers in 11 transfers of 13 bytes.
+bool is31fl3729_write_pwm_buffer(uint8_t index) {
+    // Transmit the dirty PWM registers in transfers of up to 13 bytes.
 
-    // Iterate over the pwm_buffer contents at 13 byte intervals.
-    for (uint8_t i = 0; i <= IS31FL3729_PWM_REGISTER_COUNT; i += 13) {
+    // Iterate over the dirty spans of the pwm_buffer contents.
+    bool    success = true;
+    uint8_t length;
+    for (uint8_t i = 0; (length = is31_dirty_next_span(driver_buffers[index].pwm_buffer_dirty, &i, IS31FL3729_PWM_REGISTER_COUNT, 13)) > 0; i += length) {
+        i2c_status_t status = i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3729_I2C_TIMEOUT);
 #if IS31FL3729_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3729_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+        for (uint8_t j = 1; j < IS31FL3729_I2C_PERSISTENCE && status != I2C_STATUS_SUCCESS; j++) {
+            status = i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, length, IS31FL3729_I2C_TIMEOUT);
         }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT);
 #endif
+        if (status != I2C_STATUS_SUCCESS) {
+            success = false;
+        }
     }
+
+    return success;
 }
 
 void is31fl3729_init_drivers(void) {
@@ -165,7 +172,7 @@ void is31fl3729_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= is31_dirty_bit(led.v);
     }
 }
 
@@ -190,9 +197,9 @@ void is31fl3729_set_scaling_register(uint8_t index, uint8_t value) {
 
 void is31fl3729_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3729_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
+        if (is31fl3729_write_pwm_buffer(index)) {
+            driver_buffers[index].pwm_buffer_dirty = 0;
+        }
     }
 }
 
@@ -19,6 +19,7 @@
 
 #include "is31fl3741-mono.h"
 #include "i2c_master.h"
+#include "is31_dirty.h"
 #include "gpio.h"
 #include "wait.h"
 
@@ -75,18 +76,20 @@ const uint8_t i2c_addresses[IS31FL3741_DRIVER_COUNT] = {
 // buffers and the transfers in is31fl3741_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 typedef struct is31fl3741_driver_t {
-    uint8_t pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
-    uint8_t pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
-    uint8_t scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
-    bool    scaling_buffer_dirty;
+    uint8_t      pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
+    uint8_t      pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
+    is31_dirty_t pwm_buffer_0_dirty;
+    is31_dirty_t pwm_buffer_1_dirty;
+    uint8_t      scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
+    uint8_t      scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
+    bool         scaling_buffer_dirty;
 } PACKED is31fl3741_driver_t;
 
 is31fl3741_driver_t driver_buffers[IS31FL3741_DRIVER_COUNT] = {{
     .pwm_buffer_0         = {0},
     .pwm_buffer_1         = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_0_dirty   = 0,
+    .pwm_buffer_1_dirty   = 0,
     .scaling_buffer_0     = {0},
     .scaling_buffer_1     = {0},
     .scaling_buffer_dirty = false,
@@ -107,36 +110,45 @@ void is31fl3741_select_page(uint8_t index, uint8_t page) {
     is31fl3741_write_register(index, IS31FL3741_REG_COMMAND, page);
 }
 
-void is31fl3741_write_pwm_buffer(uint8_t index) {
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
+bool is31fl3741_write_pwm_buffer(uint8_t index) {
+    bool    success = true;
+    uint8_t length;
 
-    // Transmit PWM0 registers in 6 transfers of 30 bytes.
+    if (driver_buffers[index].pwm_buffer_0_dirty) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
 
-    // Iterate over the pwm_buffer_0 contents at 30 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_0_REGISTER_COUNT; i += 30) {
+        // Transmit the dirty PWM0 registers in transfers of up to 30 bytes.
+        for (uint8_t i = 0; (length = is31_dirty_next_span(driver_buffers[index].pwm_buffer_0_dirty, &i, IS31FL3741_PWM_0_REGISTER_COUNT, 30)) > 0; i += length) {
+            i2c_status_t status = i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, length, IS31FL3741_I2C_TIMEOUT);
 #if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT);
+            for (uint8_t j = 1; j < IS31FL3741_I2C_PERSISTENCE && status != I2C_STATUS_SUCCESS; j++) {
+                status = i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, length, IS31FL3741_I2C_TIMEOUT);
+            }
 #endif
+            if (status != I2C_STATUS_SUCCESS) {
+                success = false;
+            }
+        }
     }
 
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
+    if (driver_buffers[index].pwm_buffer_1_dirty) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
 
-    // Transmit PWM1 registers in 9 transfers of 19 bytes.
-
-    // Iterate over the pwm_buffer_1 contents at 19 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_1_REGISTER_COUNT; i += 19) {
+        // Transmit the dirty PWM1 registers in transfers of up to 19 bytes.
+        for (uint8_t i = 0; (length = is31_dirty_next_span(driver_buffers[index].pwm_buffer_1_dirty, &i, IS31FL3741_PWM_1_REGISTER_COUNT, 19)) > 0; i += length) {
+            i2c_status_t status = i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, length, IS31FL3741_I2C_TIMEOUT);
 #if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT);
+            for (uint8_t j = 1; j < IS31FL3741_I2C_PERSISTENCE && status != I2C_STATUS_SUCCESS; j++) {
+                status = i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, length, IS31FL3741_I2C_TIMEOUT);
+            }
 #endif
+            if (status != I2C_STATUS_SUCCESS) {
+                success = false;
+            }
+        }
     }
+
+    return success;
 }
 
 void is31fl3741_init_drivers(void) {
@@ -196,8 +208,10 @@ uint8_t get_pwm_value(uint8_t driver, uint16_t reg) {
 void set_pwm_value(uint8_t driver, uint16_t reg, uint8_t value) {
     if (reg & 0x100) {
         driver_buffers[driver].pwm_buffer_1[reg & 0xFF] = value;
+        driver_buffers[driver].pwm_buffer_1_dirty |= is31_dirty_bit(reg & 0xFF);
     } else {
         driver_buffers[driver].pwm_buffer_0[reg] = value;
+        driver_buffers[driver].pwm_buffer_0_dirty |= is31_dirty_bit(reg);
     }
 }
 
@@ -212,7 +226,6 @@ void is31fl3741_set_value(int index, uint8_t value) {
         }
 
         set_pwm_value(led.driver, led.v, value);
-        driver_buffers[led.driver].pwm_buffer_dirty = true;
     }
 }
 
@@ -240,16 +253,16 @@ void is31fl3741_set_led_control_register(uint8_t index, bool value) {
 }
 
 void is31fl3741_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3741_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
+    if (driver_buffers[index].pwm_buffer_0_dirty || driver_buffers[index].pwm_buffer_1_dirty) {
+        if (is31fl3741_write_pwm_buffer(index)) {
+            driver_buffers[index].pwm_buffer_0_dirty = 0;
+            driver_buffers[index].pwm_buffer_1_dirty = 0;
+        }
     }
 }
 
 void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t value) {
     set_pwm_value(pled->driver, pled->v, value);
-    driver_buffers[pled->driver].pwm_buffer_dirty = true;
 }
 
 void is31fl3741_update_led_control_registers(uint8_t index) {
@@ -156,6 +156,12 @@ uint8_t         oled_rotation_width = 0;
 uint8_t         oled_scroll_speed   = 0; // this holds the speed after being remapped to ssd1306 internal values
 uint8_t         oled_scroll_start   = 0;
 uint8_t         oled_scroll_end     = 7;
+#ifdef OLED_PRE_ROTATE
+// Each block of oled_buffer already rotated into the layout the OLED expects, so rendering with 90 degree rotation can
+// send blocks straight from here
+static uint8_t         oled_rotated_buffer[OLED_MATRIX_SIZE];
+static OLED_BLOCK_TYPE oled_rotated = 0; // dirty blocks which are up to date in oled_rotated_buffer
+#endif
 #if OLED_TIMEOUT > 0
 uint32_t oled_timeout;
 #endif
@@ -376,10 +382,17 @@ __attribute__((weak)) oled_rotation_t oled_init_user(oled_rotation_t rotation) {
     return rotation;
 }
 
+static inline void oled_mark_dirty(OLED_BLOCK_TYPE blocks) {
+    oled_dirty |= blocks;
+#ifdef OLED_PRE_ROTATE
+    oled_rotated &= ~blocks;
+#endif
+}
+
 void oled_clear(void) {
     memset(oled_buffer, 0, sizeof(oled_buffer));
     oled_cursor = &oled_buffer[0];
-    oled_dirty  = OLED_ALL_BLOCKS_MASK;
+    oled_mark_dirty(OLED_ALL_BLOCKS_MASK);
 }
 
 static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
@@ -437,14 +450,61 @@ uint8_t crot(uint8_t a, int8_t n) {
     return a << n | a >> (-n & mask);
 }
 
+// Transposes an 8x8 block of pixels, OR-ing bit i of src[j] into bit (7 - j) of dest[i].
 static void rotate_90(const uint8_t *src, uint8_t *dest) {
-    for (uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
-        uint8_t selector = (1 << i);
-        for (uint8_t j = 0; j < 8; ++j) {
-            dest[i] |= crot(src[j] & selector, shift - (int8_t)j);
+    // Swaps progressively larger sub-blocks in parallel within two 32 bit words (Hacker's Delight, transpose8),
+    // rather than moving the 64 bits one by one.
+    uint32_t x = ((uint32_t)src[0] << 24) | ((uint32_t)src[1] << 16) | ((uint32_t)src[2] << 8) | src[3];
+    uint32_t y = ((uint32_t)src[4] << 24) | ((uint32_t)src[5] << 16) | ((uint32_t)src[6] << 8) | src[7];
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    dest[0] |= (uint8_t)y;
+    dest[1] |= (uint8_t)(y >> 8);
+    dest[2] |= (uint8_t)(y >> 16);
+    dest[3] |= (uint8_t)(y >> 24);
+    dest[4] |= (uint8_t)x;
+    dest[5] |= (uint8_t)(x >> 8);
+    dest[6] |= (uint8_t)(x >> 16);
+    dest[7] |= (uint8_t)(x >> 24);
+}
+
+static void rotate_block_90(uint8_t block, uint8_t *dest) {
+    const static uint8_t source_map[] = OLED_SOURCE_MAP;
+    const static uint8_t target_map[] = OLED_TARGET_MAP;
+
+    memset(dest, 0, OLED_BLOCK_SIZE);
+    for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+        rotate_90(&oled_buffer[OLED_BLOCK_SIZE * block + source_map[i]], &dest[target_map[i]]);
+    }
+}
+
+#ifdef OLED_PRE_ROTATE
+// Rotates the dirty blocks which changed since they were last rotated into oled_rotated_buffer
+static void oled_pre_rotate_dirty(void) {
+    OLED_BLOCK_TYPE pending = oled_dirty & ~oled_rotated;
+    for (uint8_t block = 0; pending; ++block) {
+        if (pending & ((OLED_BLOCK_TYPE)1 << block)) {
+            rotate_block_90(block, &oled_rotated_buffer[OLED_BLOCK_SIZE * block]);
+            pending &= ~((OLED_BLOCK_TYPE)1 << block);
         }
     }
+    oled_rotated = oled_dirty;
 }
+#endif
 
 void oled_render_dirty(bool all) {
     // Do we have work to do?
@@ -456,6 +516,13 @@ void oled_render_dirty(bool all) {
     // Turn on display if it is off
     oled_on();
 
+#ifdef OLED_PRE_ROTATE
+    // Bring every dirty block up to date in one pass, so that renders limited by OLED_UPDATE_PROCESS_LIMIT only send data
+    if (HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        oled_pre_rotate_dirty();
+    }
+#endif
+
     uint8_t update_start  = 0;
     uint8_t num_processed = 0;
     while (oled_dirty && (num_processed++ < OLED_UPDATE_PROCESS_LIMIT || all)) { // render all dirty blocks (up to the configured limit)
@@ -489,15 +556,14 @@ void oled_render_dirty(bool all) {
                 return;
             }
         } else {
+#ifdef OLED_PRE_ROTATE
+            // Render chunk was rotated ahead of time
+            const uint8_t *temp_buffer = &oled_rotated_buffer[OLED_BLOCK_SIZE * update_start];
+#else
             // Rotate the render chunks
-            const static uint8_t source_map[] = OLED_SOURCE_MAP;
-            const static uint8_t target_map[] = OLED_TARGET_MAP;
-
             static uint8_t temp_buffer[OLED_BLOCK_SIZE];
-            memset(temp_buffer, 0, sizeof(temp_buffer));
-            for (uint8_t i = 0; i < sizeof(source_map); ++i) {
-                rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
-            }
+            rotate_block_90(update_start, temp_buffer);
+#endif
 
 #if OLED_IC_HAS_HORIZONTAL_MODE
             // Send render data chunk after rotating
@@ -529,6 +595,9 @@ void oled_render_dirty(bool all) {
 
         // Clear dirty flag of just rendered block
         oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+#ifdef OLED_PRE_ROTATE
+        oled_rotated &= ~((OLED_BLOCK_TYPE)1 << update_start);
+#endif
     }
 }
 
@@ -620,9 +689,9 @@ void oled_write_char(const char data, bool invert) {
     // Dirty check
     if (memcmp(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH)) {
         uint16_t index = oled_cursor - &oled_buffer[0];
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+        oled_mark_dirty((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
         // Edgecase check if the written data spans the 2 chunks
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << ((index + OLED_FONT_WIDTH - 1) / OLED_BLOCK_SIZE));
+        oled_mark_dirty((OLED_BLOCK_TYPE)1 << ((index + OLED_FONT_WIDTH - 1) / OLED_BLOCK_SIZE));
     }
 
     // Finally move to the next char
@@ -657,7 +726,7 @@ void oled_pan(bool left) {
             }
         }
     }
-    oled_dirty = OLED_ALL_BLOCKS_MASK;
+    oled_mark_dirty(OLED_ALL_BLOCKS_MASK);
 }
 
 oled_buffer_reader_t oled_read_raw(uint16_t start_index) {
@@ -672,7 +741,7 @@ void oled_write_raw_byte(const char data, uint16_t index) {
     if (index > OLED_MATRIX_SIZE) index = OLED_MATRIX_SIZE;
     if (oled_buffer[index] == data) return;
     oled_buffer[index] = data;
-    oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+    oled_mark_dirty((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
 }
 
 void oled_write_raw(const char *data, uint16_t size) {
@@ -682,7 +751,7 @@ void oled_write_raw(const char *data, uint16_t size) {
         uint8_t c = *data++;
         if (oled_buffer[i] == c) continue;
         oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        oled_mark_dirty((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
     }
 }
 
@@ -702,7 +771,7 @@ void oled_write_pixel(uint8_t x, uint8_t y, bool on) {
     }
     if (oled_buffer[index] != data) {
         oled_buffer[index] = data;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+        oled_mark_dirty((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
     }
 }
 
@@ -727,7 +796,7 @@ void oled_write_raw_P(const char *data, uint16_t size) {
         uint8_t c = pgm_read_byte(data++);
         if (oled_buffer[i] == c) continue;
         oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        oled_mark_dirty((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
     }
 }
 #endif // defined(__AVR__)
@@ -877,7 +946,7 @@ bool oled_scroll_off(void) {
             return oled_scrolling;
         }
         oled_scrolling = false;
-        oled_dirty     = OLED_ALL_BLOCKS_MASK;
+        oled_mark_dirty(OLED_ALL_BLOCKS_MASK);
     }
     return !oled_scrolling;
 }
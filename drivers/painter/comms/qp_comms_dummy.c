@@ -4,6 +4,7 @@
 #ifdef QUANTUM_PAINTER_DUMMY_COMMS_ENABLE
 
 #    include "qp_comms_dummy.h"
+#    include "qp_comms.h"
 
 static bool dummy_comms_init(painter_device_t device) {
     // No-op.
@@ -24,11 +25,56 @@ uint32_t dummy_comms_send(painter_device_t device, const void *data, uint32_t by
     return byte_count;
 }
 
+#    if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
+// Asynchronous transfers only complete once they're waited upon, so that the double-buffered pixdata pipeline can be
+// validated on the host -- any modification of a buffer while its transfer is still pending is counted as an overwrite.
+dummy_comms_async_stats_t dummy_comms_async_stats = {0};
+
+static const void *pending_data       = NULL;
+static uint32_t    pending_byte_count = 0;
+static uint32_t    pending_checksum   = 0;
+
+static uint32_t dummy_comms_checksum(const void *data, uint32_t byte_count) {
+    const uint8_t *p    = (const uint8_t *)data;
+    uint32_t       hash = 2166136261u;
+    for (uint32_t i = 0; i < byte_count; ++i) {
+        hash = (hash ^ p[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static bool dummy_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    pending_data       = data;
+    pending_byte_count = byte_count;
+    pending_checksum   = dummy_comms_checksum(data, byte_count);
+    dummy_comms_async_stats.transfers++;
+    return true;
+}
+
+static void dummy_comms_poll(painter_device_t device) {
+    if (pending_data) {
+        if (dummy_comms_checksum(pending_data, pending_byte_count) != pending_checksum) {
+            qp_dprintf("dummy_comms_poll: buffer modified during asynchronous transfer\n");
+            dummy_comms_async_stats.overwrites++;
+        }
+        pending_data = NULL;
+    }
+    qp_comms_send_async_complete(device);
+}
+
+#    endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
 painter_comms_vtable_t dummy_comms_vtable = {
     // These are all effective no-op's because they're not actually needed.
     .comms_init  = dummy_comms_init,
     .comms_start = dummy_comms_start,
     .comms_stop  = dummy_comms_stop,
-    .comms_send  = dummy_comms_send};
+    .comms_send  = dummy_comms_send,
+#    if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    .comms_send_async = dummy_comms_send_async,
+    .comms_poll       = dummy_comms_poll,
+#    endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+};
 
 #endif // QUANTUM_PAINTER_DUMMY_COMMS_ENABLE
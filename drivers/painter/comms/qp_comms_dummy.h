@@ -8,4 +8,13 @@
 
 extern painter_comms_vtable_t dummy_comms_vtable;
 
+#    if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+typedef struct dummy_comms_async_stats_t {
+    uint32_t transfers;  // number of asynchronous transfers started
+    uint32_t overwrites; // number of buffers modified before their transfer completed
+} dummy_comms_async_stats_t;
+
+extern dummy_comms_async_stats_t dummy_comms_async_stats;
+#    endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
 #endif // QUANTUM_PAINTER_DUMMY_COMMS_ENABLE
@@ -5,6 +5,7 @@
 
 #    include "spi_master.h"
 #    include "qp_comms_spi.h"
+#    include "qp_comms.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base SPI support
@@ -45,6 +46,25 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
     return byte_count - bytes_remaining;
 }
 
+#    if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
+static void qp_comms_spi_async_complete(void *arg) {
+    qp_comms_send_async_complete((painter_device_t)arg);
+}
+
+bool qp_comms_spi_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    // Transfers too large for a single DMA transaction go out synchronously instead
+    if (byte_count > UINT16_MAX) {
+        qp_comms_spi_send_data(device, data, byte_count);
+        qp_comms_send_async_complete(device);
+        return true;
+    }
+
+    return spi_transmit_async((const uint8_t *)data, byte_count, qp_comms_spi_async_complete, device) == SPI_STATUS_SUCCESS;
+}
+
+#    endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
 void qp_comms_spi_stop(painter_device_t device) {
     painter_driver_t *     driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
@@ -57,6 +77,9 @@ const painter_comms_vtable_t spi_comms_vtable = {
     .comms_start = qp_comms_spi_start,
     .comms_send  = qp_comms_spi_send_data,
     .comms_stop  = qp_comms_spi_stop,
+#    if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    .comms_send_async = qp_comms_spi_send_data_async,
+#    endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +120,15 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
     return qp_comms_spi_send_data(device, data, byte_count);
 }
 
+#        if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+bool qp_comms_spi_dc_reset_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    painter_driver_t *              driver       = (painter_driver_t *)device;
+    qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    gpio_write_pin_high(comms_config->dc_pin);
+    return qp_comms_spi_send_data_async(device, data, byte_count);
+}
+#        endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
@@ -135,6 +167,9 @@ const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
             .comms_start = qp_comms_spi_start,
             .comms_send  = qp_comms_spi_dc_reset_send_data,
             .comms_stop  = qp_comms_spi_stop,
+#        if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+            .comms_send_async = qp_comms_spi_dc_reset_send_data_async,
+#        endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
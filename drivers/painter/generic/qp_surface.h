@@ -21,6 +21,24 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_RECTS
+/**
+ * @def This controls the number of separate dirty rectangles tracked by each surface. Drawing to areas that are far
+ *      apart (such as opposite corners) keeps them as separate rectangles, so that only the changed areas are
+ *      transferred to the display. Each rectangle costs 8 bytes of RAM per surface.
+ */
+#    define SURFACE_DIRTY_RECTS 4
+#endif
+
+#ifndef SURFACE_DIRTY_MERGE_DISTANCE
+/**
+ * @def Dirty rectangles closer than this many pixels to each other are merged into one. Each transferred rectangle
+ *      costs a viewport command on the display, so merging nearby areas is usually cheaper than sending them
+ *      separately.
+ */
+#    define SURFACE_DIRTY_MERGE_DISTANCE 8
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
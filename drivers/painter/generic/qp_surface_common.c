@@ -29,7 +29,57 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
+static inline uint32_t dirty_rect_area(const surface_dirty_rect_t *rect) {
+    return (uint32_t)(rect->r - rect->l + 1) * (uint32_t)(rect->b - rect->t + 1);
+}
+
+static inline surface_dirty_rect_t dirty_rect_union(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    return (surface_dirty_rect_t){.l = MIN(a->l, b->l), .t = MIN(a->t, b->t), .r = MAX(a->r, b->r), .b = MAX(a->b, b->b)};
+}
+
+// Number of pixels that would be transferred needlessly if both rectangles were replaced by their union
+static inline int32_t dirty_rect_merge_cost(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    surface_dirty_rect_t merged = dirty_rect_union(a, b);
+    return (int32_t)dirty_rect_area(&merged) - (int32_t)dirty_rect_area(a) - (int32_t)dirty_rect_area(b);
+}
+
+static inline bool dirty_rect_near(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    return (uint32_t)a->l <= (uint32_t)b->r + SURFACE_DIRTY_MERGE_DISTANCE && (uint32_t)b->l <= (uint32_t)a->r + SURFACE_DIRTY_MERGE_DISTANCE && (uint32_t)a->t <= (uint32_t)b->b + SURFACE_DIRTY_MERGE_DISTANCE && (uint32_t)b->t <= (uint32_t)a->b + SURFACE_DIRTY_MERGE_DISTANCE;
+}
+
+static inline void dirty_rect_remove(surface_dirty_data_t *dirty, uint8_t index) {
+    dirty->rects[index] = dirty->rects[--dirty->rect_count];
+}
+
+// Folds any rectangles near the one at `index` into it, repeating until nothing else is in range
+static void dirty_rect_coalesce(surface_dirty_data_t *dirty, uint8_t index) {
+    uint8_t i = 0;
+    while (i < dirty->rect_count) {
+        if (i != index && dirty_rect_near(&dirty->rects[index], &dirty->rects[i])) {
+            dirty->rects[index] = dirty_rect_union(&dirty->rects[index], &dirty->rects[i]);
+            // The last rectangle moves into the freed slot, which may be the one being grown
+            if (index == dirty->rect_count - 1) {
+                index = i;
+            }
+            dirty_rect_remove(dirty, i);
+            i = 0;
+        } else {
+            ++i;
+        }
+    }
+}
+
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
+    surface_dirty_rect_t point = {.l = x, .t = y, .r = x, .b = y};
+
+    // Nothing to do if the pixel is already inside a dirty area
+    for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+        surface_dirty_rect_t *rect = &dirty->rects[i];
+        if (x >= rect->l && x <= rect->r && y >= rect->t && y <= rect->b) {
+            return;
+        }
+    }
+
     // Maintain dirty region
     if (dirty->l > x) {
         dirty->l        = x;
@@ -47,6 +97,78 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
         dirty->b        = y;
         dirty->is_dirty = true;
     }
+
+    // Find the existing rectangles that need to grow the least to include the pixel, overall and within merge distance
+    int16_t best_rect = -1;
+    int32_t best_cost = INT32_MAX;
+    int16_t near_rect = -1;
+    int32_t near_cost = INT32_MAX;
+    for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+        int32_t cost = dirty_rect_merge_cost(&dirty->rects[i], &point) + 1;
+        if (cost < best_cost) {
+            best_rect = i;
+            best_cost = cost;
+        }
+        if (cost < near_cost && dirty_rect_near(&dirty->rects[i], &point)) {
+            near_rect = i;
+            near_cost = cost;
+        }
+    }
+
+    // Grow a nearby rectangle if there is one
+    if (near_rect >= 0) {
+        dirty->rects[near_rect] = dirty_rect_union(&dirty->rects[near_rect], &point);
+        dirty_rect_coalesce(dirty, near_rect);
+        return;
+    }
+
+    // Otherwise, start a new rectangle if there's space
+    if (dirty->rect_count < SURFACE_DIRTY_RECTS) {
+        dirty->rects[dirty->rect_count++] = point;
+        return;
+    }
+
+    // Out of rectangles -- either grow the cheapest one, or merge the two existing rectangles that waste the fewest pixels
+    // together, freeing up a slot for the new pixel
+    uint8_t pair_a    = 0;
+    uint8_t pair_b    = 0;
+    int32_t pair_cost = INT32_MAX;
+    for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+        for (uint8_t j = i + 1; j < dirty->rect_count; ++j) {
+            int32_t cost = dirty_rect_merge_cost(&dirty->rects[i], &dirty->rects[j]);
+            if (cost < pair_cost) {
+                pair_a    = i;
+                pair_b    = j;
+                pair_cost = cost;
+            }
+        }
+    }
+
+    if (pair_cost < best_cost) {
+        dirty->rects[pair_a] = dirty_rect_union(&dirty->rects[pair_a], &dirty->rects[pair_b]);
+        dirty->rects[pair_b] = point;
+        dirty_rect_coalesce(dirty, pair_a);
+    } else {
+        dirty->rects[best_rect] = dirty_rect_union(&dirty->rects[best_rect], &point);
+        dirty_rect_coalesce(dirty, best_rect);
+    }
+}
+
+void qp_surface_reset_dirty(surface_dirty_data_t *dirty) {
+    dirty->l = dirty->t = UINT16_MAX;
+    dirty->r = dirty->b = 0;
+    dirty->is_dirty     = false;
+    dirty->rect_count   = 0;
+}
+
+void qp_surface_mark_dirty(surface_dirty_data_t *dirty, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    dirty->l          = left;
+    dirty->t          = top;
+    dirty->r          = right;
+    dirty->b          = bottom;
+    dirty->is_dirty   = true;
+    dirty->rect_count = 1;
+    dirty->rects[0]   = (surface_dirty_rect_t){.l = left, .t = top, .r = right, .b = bottom};
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,11 +179,7 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
 
-    surface->dirty.l        = 0;
-    surface->dirty.t        = 0;
-    surface->dirty.r        = surface->base.panel_width - 1;
-    surface->dirty.b        = surface->base.panel_height - 1;
-    surface->dirty.is_dirty = true;
+    qp_surface_mark_dirty(&surface->dirty, 0, 0, surface->base.panel_width - 1, surface->base.panel_height - 1);
 
     return true;
 }
@@ -80,9 +198,7 @@ bool qp_surface_clear(painter_device_t device) {
 bool qp_surface_flush(painter_device_t device) {
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
-    surface->dirty.l = surface->dirty.t = UINT16_MAX;
-    surface->dirty.r = surface->dirty.b = 0;
-    surface->dirty.is_dirty             = false;
+    qp_surface_reset_dirty(&surface->dirty);
     return true;
 }
 
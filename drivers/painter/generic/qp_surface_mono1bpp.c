@@ -88,7 +88,7 @@ static bool mono1bpp_target_pixdata_transfer(painter_driver_t *surface_driver, p
     return false; // Not yet supported.
 }
 
-static bool qp_surface_append_pixdata_mono1bpp(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+static bool qp_surface_append_pixdata_mono1bpp(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint32_t pixdata_byte_count, const uint8_t *pixdata) {
     return false; // Just use 1bpp images.
 }
 
@@ -6,6 +6,7 @@
 #    include "color.h"
 #    include "qp_draw.h"
 #    include "qp_surface_internal.h"
+#    include "qp_comms.h"
 #    include "qp_comms_dummy.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -68,18 +69,19 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+static bool rgb565_target_pixdata_transfer_rect(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
 
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
-
     // Set the target drawing area
     bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
     if (!ok) {
-        qp_dprintf("rgb565_target_pixdata_transfer: fail (could not set target viewport)\n");
+        qp_dprintf("rgb565_target_pixdata_transfer_rect: fail (could not set target viewport)\n");
+        return false;
+    }
+
+    // Keep comms open across the whole area, so that the target can stream one buffer while the next is being filled
+    if (!qp_comms_start((painter_device_t)target_driver)) {
+        qp_dprintf("rgb565_target_pixdata_transfer_rect: fail (could not start comms)\n");
         return false;
     }
 
@@ -89,29 +91,46 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
 
     // Fill the global pixdata area so that we can start transferring to the panel
-    for (uint16_t y = t; y <= b; ++y) {
-        for (uint16_t x = l; x <= r; ++x) {
+    for (uint16_t y = t; ok && y <= b; ++y) {
+        for (uint16_t x = l; ok && x <= r; ++x) {
             // Update the target buffer
             target_buffer[pixel_counter++] = surface_handle->u16buffer[y * surface_handle->base.panel_width + x];
 
             // If we've accumulated enough data, send it
             if (pixel_counter == total_pixel_count) {
-                ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
-                if (!ok) {
-                    qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
-                    return false;
-                }
-                // Reset the counter
+                ok = qp_internal_pixdata_flush((painter_device_t)target_driver, pixel_counter);
+                // Reset the counter, and pick up whichever buffer is now free to fill
                 pixel_counter = 0;
+                target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
             }
         }
     }
 
     // If there's any leftover data, send it
-    if (pixel_counter > 0) {
-        ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
-        if (!ok) {
-            qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
+    if (ok && pixel_counter > 0) {
+        ok = qp_internal_pixdata_flush((painter_device_t)target_driver, pixel_counter);
+    }
+
+    qp_comms_stop((painter_device_t)target_driver);
+    if (!ok) {
+        qp_dprintf("rgb565_target_pixdata_transfer_rect: fail (could not stream pixdata to target)\n");
+        return false;
+    }
+
+    return true;
+}
+
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    if (entire_surface) {
+        return rgb565_target_pixdata_transfer_rect(surface_driver, target_driver, x, y, 0, 0, surface_handle->base.panel_width - 1, surface_handle->base.panel_height - 1);
+    }
+
+    // Only send the areas that actually changed
+    for (uint8_t i = 0; i < surface_handle->dirty.rect_count; ++i) {
+        surface_dirty_rect_t *rect = &surface_handle->dirty.rects[i];
+        if (!rgb565_target_pixdata_transfer_rect(surface_driver, target_driver, x, y, rect->l, rect->t, rect->r, rect->b)) {
             return false;
         }
     }
@@ -119,8 +138,8 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     return true;
 }
 
-static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
-    target_buffer[pixdata_offset] = pixdata_byte;
+static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint32_t pixdata_byte_count, const uint8_t *pixdata) {
+    memcpy(&target_buffer[pixdata_offset], pixdata, pixdata_byte_count);
     return true;
 }
 
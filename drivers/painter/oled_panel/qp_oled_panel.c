@@ -49,9 +49,9 @@ bool qp_oled_panel_passthru_append_pixels(painter_device_t device, uint8_t *targ
     return driver->surface.base.validate_ok && driver->surface.base.driver_vtable->append_pixels(&driver->surface.base, target_buffer, palette, pixel_offset, pixel_count, palette_indices);
 }
 
-bool qp_oled_panel_passthru_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+bool qp_oled_panel_passthru_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint32_t pixdata_byte_count, const uint8_t *pixdata) {
     oled_panel_painter_device_t *driver = (oled_panel_painter_device_t *)device;
-    return driver->surface.base.validate_ok && driver->surface.base.driver_vtable->append_pixdata(&driver->surface.base, target_buffer, pixdata_offset, pixdata_byte);
+    return driver->surface.base.validate_ok && driver->surface.base.driver_vtable->append_pixdata(&driver->surface.base, target_buffer, pixdata_offset, pixdata_byte_count, pixdata);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -193,3 +193,27 @@ void qp_oled_panel_page_column_flush_rot270(painter_device_t device, surface_dir
         qp_comms_send(device, column_data, cols_required);
     }
 }
+
+void qp_oled_panel_page_column_flush(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+
+    // Flush each dirty rectangle separately, so that far-apart updates don't drag in everything in between
+    for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+        surface_dirty_data_t region = {.is_dirty = true, .l = dirty->rects[i].l, .t = dirty->rects[i].t, .r = dirty->rects[i].r, .b = dirty->rects[i].b};
+        switch (driver->rotation) {
+            default:
+            case QP_ROTATION_0:
+                qp_oled_panel_page_column_flush_rot0(device, &region, framebuffer);
+                break;
+            case QP_ROTATION_90:
+                qp_oled_panel_page_column_flush_rot90(device, &region, framebuffer);
+                break;
+            case QP_ROTATION_180:
+                qp_oled_panel_page_column_flush_rot180(device, &region, framebuffer);
+                break;
+            case QP_ROTATION_270:
+                qp_oled_panel_page_column_flush_rot270(device, &region, framebuffer);
+                break;
+        }
+    }
+}
@@ -81,7 +81,7 @@ bool qp_tft_panel_viewport(painter_device_t device, uint16_t left, uint16_t top,
 // Stream pixel data to the current write position in GRAM
 bool qp_tft_panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
     painter_driver_t *driver = (painter_driver_t *)device;
-    qp_comms_send(device, pixel_data, native_pixel_count * driver->native_bits_per_pixel / 8);
+    qp_comms_send_async(device, pixel_data, native_pixel_count * driver->native_bits_per_pixel / 8);
     return true;
 }
 
@@ -127,7 +127,7 @@ bool qp_tft_panel_append_pixels_rgb888(painter_device_t device, uint8_t *target_
     return true;
 }
 
-bool qp_tft_panel_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
-    target_buffer[pixdata_offset] = pixdata_byte;
+bool qp_tft_panel_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint32_t pixdata_byte_count, const uint8_t *pixdata) {
+    memcpy(&target_buffer[pixdata_offset], pixdata, pixdata_byte_count);
     return true;
 }
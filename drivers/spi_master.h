@@ -93,6 +93,32 @@ spi_status_t spi_read(void);
  */
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * \brief Callback invoked once an asynchronous transmission has completed.
+ *
+ * \param arg The argument supplied to `spi_transmit_async()`.
+ */
+typedef void (*spi_transmit_complete_cb_t)(void *arg);
+
+/**
+ * \brief Start sending multiple bytes to the selected SPI device, returning before the transfer has completed where the platform supports it.
+ *
+ * Only one asynchronous transmission may be in flight at a time; any previous one is waited on first. The contents of `data` must not be modified until `callback` has been invoked.
+ *
+ * \param data A pointer to the data to write from.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ * \param callback Function invoked once the transmission has completed, potentially from interrupt context. May be `NULL`.
+ * \param arg Argument passed through to `callback`.
+ *
+ * \return `SPI_STATUS_ERROR` if the transmission could not be started, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length, spi_transmit_complete_cb_t callback, void *arg);
+
+/**
+ * \brief Wait for any in-flight asynchronous transmission to complete.
+ */
+void spi_transmit_wait(void);
+
 /**
  * \brief Receive multiple bytes from the selected SPI device.
  *
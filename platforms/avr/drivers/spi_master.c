@@ -171,6 +171,24 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length, spi_transmit_complete_cb_t callback, void *arg) {
+    // No DMA available, so just transmit synchronously
+    spi_status_t status = spi_transmit(data, length);
+    if (status < 0) {
+        return status;
+    }
+
+    if (callback) {
+        callback(arg);
+    }
+
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_transmit_wait(void) {
+    // No-op, transmissions are always synchronous.
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spi_status_t status;
 
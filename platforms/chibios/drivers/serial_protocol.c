@@ -25,6 +25,10 @@ static THD_FUNCTION(SlaveThread, arg) {
              * Parts of failed transactions or spurious bytes could still be in it. */
             serial_transport_driver_clear();
         }
+#if defined(SPLIT_LINK_ADAPTIVE_SPEED)
+        /* Apply speed changes between transactions, after the acknowledgement went out at the old speed. */
+        transactions_slave_link_speed_task();
+#endif
     }
 }
 
@@ -24,6 +24,12 @@ void serial_transport_driver_slave_init(void);
  */
 void serial_transport_driver_master_init(void);
 
+/**
+ * @brief Restarts the driver at the configured speed halved `step` times. Only
+ * called between transactions.
+ */
+void serial_transport_driver_set_speed_step(uint8_t step);
+
 /**
  * @brief  Blocking receive of size * bytes.
  *
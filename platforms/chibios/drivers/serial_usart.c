@@ -7,6 +7,10 @@
 #include "synchronization_util.h"
 #include "chibios_config.h"
 
+#if defined(SPLIT_LINK_ADAPTIVE_SPEED)
+#    include "link_stats.h"
+#endif
+
 #if defined(SERIAL_USART_CONFIG)
 static QMKSerialConfig serial_config = SERIAL_USART_CONFIG;
 #elif defined(MCU_AT32) /* AT32 MCUs */
@@ -61,6 +65,13 @@ static inline void usart_driver_start(void) {
     sdStart(serial_driver, &serial_config);
 }
 
+/**
+ * @brief SERIAL Driver shutdown routine.
+ */
+static inline void usart_driver_stop(void) {
+    sdStop(serial_driver);
+}
+
 inline void serial_transport_driver_clear(void) {
     osalSysLock();
     bool volatile queue_not_empty = !iqIsEmptyI(&serial_driver->iqueue);
@@ -91,6 +102,13 @@ static inline void usart_driver_start(void) {
     sioStart(serial_driver, &serial_config);
 }
 
+/**
+ * @brief SIO Driver shutdown routine.
+ */
+static inline void usart_driver_stop(void) {
+    sioStop(serial_driver);
+}
+
 inline void serial_transport_driver_clear(void) {
     if (sioHasRXErrorsX(serial_driver)) {
         sioGetAndClearErrors(serial_driver);
@@ -161,7 +179,12 @@ inline bool serial_transport_receive(uint8_t* destination, const size_t size) {
 }
 
 inline bool serial_transport_receive_blocking(uint8_t* destination, const size_t size) {
+#if defined(SPLIT_LINK_ADAPTIVE_SPEED)
+    /* Wake up the slave thread now and then, so it can fall back to the configured speed once the master went quiet. */
+    bool success = (size_t)chnReadTimeout(serial_driver, destination, size, TIME_MS2I(SPLIT_LINK_SPEED_TIMEOUT)) == size;
+#else
     bool success = (size_t)chnRead(serial_driver, destination, size) == size;
+#endif
     return success;
 }
 
@@ -246,3 +269,17 @@ void serial_transport_driver_master_init(void) {
 
     usart_driver_start();
 }
+
+#if defined(SPLIT_LINK_ADAPTIVE_SPEED)
+void serial_transport_driver_set_speed_step(uint8_t step) {
+    usart_driver_stop();
+#    if defined(SERIAL_USART_CONFIG)
+#        error SPLIT_LINK_ADAPTIVE_SPEED does not know which field of a custom SERIAL_USART_CONFIG holds the speed.
+#    elif defined(MCU_AT32) || (defined(MCU_STM32) && HAL_USE_SERIAL)
+    serial_config.speed = (SERIAL_USART_SPEED) >> step;
+#    else
+    serial_config.baud = (SERIAL_USART_SPEED) >> step;
+#    endif
+    usart_driver_start();
+}
+#endif
@@ -67,6 +67,20 @@ static bool  current_cs_active_low = true;
 
 static SPIConfig spiConfig;
 
+static volatile bool              spi_async_busy = false;
+static spi_transmit_complete_cb_t spi_async_callback;
+static void *                     spi_async_arg;
+
+// Invoked from the SPI interrupt at the end of every transfer
+static void spi_transfer_complete(SPIDriver *spip) {
+    if (spi_async_busy) {
+        spi_async_busy = false;
+        if (spi_async_callback) {
+            spi_async_callback(spi_async_arg);
+        }
+    }
+}
+
 static inline void spi_select(void) {
     spiSelect(&SPI_DRIVER);
 
@@ -388,6 +402,12 @@ bool spi_start_extended(spi_start_config_t *start_config) {
     }
 #endif
 
+#ifndef HAL_LLD_SELECT_SPI_V2
+    spiConfig.end_cb = spi_transfer_complete;
+#else
+    spiConfig.data_cb = spi_transfer_complete;
+#endif
+
     spiStarted = true;
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
     current_slave_pin     = start_config->slave_pin;
@@ -422,6 +442,8 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 }
 
 spi_status_t spi_write(uint8_t data) {
+    spi_transmit_wait();
+
     uint8_t rxData;
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
@@ -429,6 +451,8 @@ spi_status_t spi_write(uint8_t data) {
 }
 
 spi_status_t spi_read(void) {
+    spi_transmit_wait();
+
     uint8_t data = 0;
     spiReceive(&SPI_DRIVER, 1, &data);
 
@@ -436,16 +460,41 @@ spi_status_t spi_read(void) {
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_transmit_wait();
+
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length, spi_transmit_complete_cb_t callback, void *arg) {
+    spi_transmit_wait();
+
+    if (!spiStarted) {
+        return SPI_STATUS_ERROR;
+    }
+
+    spi_async_callback = callback;
+    spi_async_arg      = arg;
+    spi_async_busy     = true;
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_transmit_wait(void) {
+    while (spi_async_busy) {
+    }
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_transmit_wait();
+
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
+    spi_transmit_wait();
+
     if (spiStarted) {
         spi_unselect();
         spiStop(&SPI_DRIVER);
@@ -1,3 +1,4 @@
+#include <string.h>
 #include "ws2812.h"
 #include "gpio.h"
 #include "chibios_config.h"
@@ -292,6 +293,20 @@ typedef uint8_t ws2812_buffer_t;
 
 static ws2812_buffer_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
 
+/**
+ * @brief   Duty cycles for each bit of a nibble, most significant bit first
+ *
+ * A full 256 entry byte table would take up to 8kB with 32-bit timers, so each
+ * byte is encoded as two lookups into this 16 entry table instead.
+ */
+#define WS2812_NIBBLE_BIT(data, bit) ((((data) >> (bit)) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0)
+#define WS2812_NIBBLE(data) {WS2812_NIBBLE_BIT(data, 3), WS2812_NIBBLE_BIT(data, 2), WS2812_NIBBLE_BIT(data, 1), WS2812_NIBBLE_BIT(data, 0)}
+
+static const ws2812_buffer_t ws2812_nibble_lut[16][4] = {
+    WS2812_NIBBLE(0),  WS2812_NIBBLE(1),  WS2812_NIBBLE(2),  WS2812_NIBBLE(3),  WS2812_NIBBLE(4),  WS2812_NIBBLE(5),  WS2812_NIBBLE(6),  WS2812_NIBBLE(7),
+    WS2812_NIBBLE(8),  WS2812_NIBBLE(9),  WS2812_NIBBLE(10), WS2812_NIBBLE(11), WS2812_NIBBLE(12), WS2812_NIBBLE(13), WS2812_NIBBLE(14), WS2812_NIBBLE(15),
+};
+
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 /*
  * Gedanke: Double-buffer type transactions: double buffer transfers using two memory pointers for
@@ -372,35 +387,48 @@ void ws2812_init(void) {
     pwmEnableChannel(&WS2812_PWM_DRIVER, WS2812_PWM_CHANNEL - 1, 0); // Initial period is 0; output will be low until first duty cycle is DMA'd in
 }
 
+/**
+ * @brief   Encode a color byte into its eight duty cycles in the frame buffer
+ *
+ * @param[out] dst:                 The frame buffer entry for the most significant bit
+ * @param[in] data:                 The color byte
+ */
+static inline void ws2812_encode_byte(ws2812_buffer_t *dst, uint8_t data) {
+    memcpy(dst, ws2812_nibble_lut[data >> 4], sizeof(ws2812_nibble_lut[0]));
+    memcpy(dst + 4, ws2812_nibble_lut[data & 0x0F], sizeof(ws2812_nibble_lut[0]));
+}
+
 void ws2812_write_led(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b) {
     // Write color to frame buffer
-    for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-    }
+    ws2812_encode_byte(&ws2812_frame_buffer[WS2812_RED_BIT(led_number, 7)], r);
+    ws2812_encode_byte(&ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, 7)], g);
+    ws2812_encode_byte(&ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, 7)], b);
 }
 void ws2812_write_led_rgbw(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
     // Write color to frame buffer
-    for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+    ws2812_encode_byte(&ws2812_frame_buffer[WS2812_RED_BIT(led_number, 7)], r);
+    ws2812_encode_byte(&ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, 7)], g);
+    ws2812_encode_byte(&ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, 7)], b);
 #ifdef WS2812_RGBW
-        ws2812_frame_buffer[WS2812_WHITE_BIT(led_number, bit)] = ((w >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+    ws2812_encode_byte(&ws2812_frame_buffer[WS2812_WHITE_BIT(led_number, 7)], w);
 #endif
-    }
 }
 
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
+// Set whenever a color changes, so unchanged frames are not encoded again
+static bool ws2812_leds_dirty = true;
+
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ws2812_leds[index].r = red;
-    ws2812_leds[index].g = green;
-    ws2812_leds[index].b = blue;
+    ws2812_led_t led = {.r = red, .g = green, .b = blue};
 #if defined(WS2812_RGBW)
-    ws2812_rgb_to_rgbw(&ws2812_leds[index]);
+    ws2812_rgb_to_rgbw(&led);
 #endif
+
+    if (memcmp(&ws2812_leds[index], &led, sizeof(led)) != 0) {
+        ws2812_leds[index] = led;
+        ws2812_leds_dirty  = true;
+    }
 }
 
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -410,11 +438,19 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
-#if defined(WS2812_RGBW)
-        ws2812_write_led_rgbw(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b, ws2812_leds[i].w);
-#else
-        ws2812_write_led(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b);
-#endif
+    // Skip re-encoding when nothing changed since the last frame
+    if (!ws2812_leds_dirty) {
+        return;
     }
+
+    // ws2812_led_t is packed in the order the channels go out on the wire, so
+    // the whole frame can be encoded straight from ws2812_leds, one byte at a time.
+    const uint8_t   *src = (const uint8_t *)ws2812_leds;
+    ws2812_buffer_t *dst = ws2812_frame_buffer;
+    for (size_t i = 0; i < sizeof(ws2812_leds); i++) {
+        ws2812_encode_byte(dst, src[i]);
+        dst += 8;
+    }
+
+    ws2812_leds_dirty = false;
 }
@@ -1,3 +1,4 @@
+#include <string.h>
 #include "ws2812.h"
 #include "gpio.h"
 #include "util.h"
@@ -117,54 +118,41 @@ static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
- * the ws2812b protocol, we use this helper function to translate bytes into
- * 0s and 1s for the LED (with the appropriate timing).
+ * the ws2812b protocol, each bit of LED data is sent as a nibble: 0b1110 for
+ * a 1 and 0b1000 for a 0. The four SPI bytes for every possible LED byte are
+ * precomputed here, so encoding a frame is a table lookup per byte.
  */
-static uint8_t get_protocol_eq(uint8_t data, int pos) {
-    uint8_t eq = 0;
-    if (data & (1 << (2 * (3 - pos))))
-        eq = 0b1110;
-    else
-        eq = 0b1000;
-    if (data & (2 << (2 * (3 - pos))))
-        eq += 0b11100000;
-    else
-        eq += 0b10000000;
-    return eq;
-}
+#define WS2812_SPI_BIT_PAIR(data, shift) (((((data) >> (shift)) & 1) ? 0b1110 : 0b1000) | ((((data) >> (shift)) & 2) ? 0b11100000 : 0b10000000))
+#define WS2812_SPI_BYTE(data) {WS2812_SPI_BIT_PAIR(data, 6), WS2812_SPI_BIT_PAIR(data, 4), WS2812_SPI_BIT_PAIR(data, 2), WS2812_SPI_BIT_PAIR(data, 0)}
+#define WS2812_SPI_BYTES_4(data) WS2812_SPI_BYTE(data), WS2812_SPI_BYTE((data) + 1), WS2812_SPI_BYTE((data) + 2), WS2812_SPI_BYTE((data) + 3)
+#define WS2812_SPI_BYTES_16(data) WS2812_SPI_BYTES_4(data), WS2812_SPI_BYTES_4((data) + 4), WS2812_SPI_BYTES_4((data) + 8), WS2812_SPI_BYTES_4((data) + 12)
+#define WS2812_SPI_BYTES_64(data) WS2812_SPI_BYTES_16(data), WS2812_SPI_BYTES_16((data) + 16), WS2812_SPI_BYTES_16((data) + 32), WS2812_SPI_BYTES_16((data) + 48)
+
+static const uint8_t ws2812_spi_lut[256][BYTES_FOR_LED_BYTE] = {
+    WS2812_SPI_BYTES_64(0),
+    WS2812_SPI_BYTES_64(64),
+    WS2812_SPI_BYTES_64(128),
+    WS2812_SPI_BYTES_64(192),
+};
 
-static void set_led_color_rgb(ws2812_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
-#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.b, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.r, j);
-#endif
-#ifdef WS2812_RGBW
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 3 + j] = get_protocol_eq(color.w, j);
-#endif
-}
+// The first flush has to encode the frame, as txbuf starts out zeroed
+static bool ws2812_leds_dirty = true;
 
-ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
+/*
+ * ws2812_led_t is packed in the order the channels go out on the wire, so the
+ * whole frame can be encoded straight from ws2812_leds, one byte at a time.
+ */
+static void ws2812_encode_leds(void) {
+    const uint8_t* src = (const uint8_t*)ws2812_leds;
+    uint8_t*       dst = &txbuf[PREAMBLE_SIZE];
+
+    for (size_t i = 0; i < sizeof(ws2812_leds); i++) {
+        memcpy(dst, ws2812_spi_lut[src[i]], BYTES_FOR_LED_BYTE);
+        dst += BYTES_FOR_LED_BYTE;
+    }
+}
 
 void ws2812_init(void) {
     palSetLineMode(WS2812_DI_PIN, WS2812_MOSI_OUTPUT_MODE);
@@ -225,12 +213,15 @@ void ws2812_init(void) {
 }
 
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
-    ws2812_leds[index].r = red;
-    ws2812_leds[index].g = green;
-    ws2812_leds[index].b = blue;
+    ws2812_led_t led = {.r = red, .g = green, .b = blue};
 #if defined(WS2812_RGBW)
-    ws2812_rgb_to_rgbw(&ws2812_leds[index]);
+    ws2812_rgb_to_rgbw(&led);
 #endif
+
+    if (memcmp(&ws2812_leds[index], &led, sizeof(led)) != 0) {
+        ws2812_leds[index] = led;
+        ws2812_leds_dirty  = true;
+    }
 }
 
 void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -240,8 +231,10 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
-        set_led_color_rgb(ws2812_leds[i], i);
+    // Skip re-encoding when nothing changed since the last frame
+    if (ws2812_leds_dirty) {
+        ws2812_encode_leds();
+        ws2812_leds_dirty = false;
     }
 
     // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
@@ -43,3 +43,14 @@ typedef ioline_t pin_t;
 #define gpio_read_pin(pin) palReadLine(pin)
 
 #define gpio_toggle_pin(pin) palToggleLine(pin)
+
+/* Operation of GPIO by port. A port is identified by any of its pins. */
+
+#if defined(PAL_PORT) && defined(PAL_PAD)
+typedef ioportmask_t gpio_port_data_t;
+
+#    define gpio_pin_port(pin) PAL_PORT(pin)
+#    define gpio_pin_pad(pin) PAL_PAD(pin)
+
+#    define gpio_read_port(pin) palReadPort(PAL_PORT(pin))
+#endif
@@ -0,0 +1,19 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <ch.h>
+
+#include "idle_scheduler.h"
+
+static BSEMAPHORE_DECL(idle_wakeup_sem, true);
+
+void idle_scheduler_sleep_platform(uint32_t timeout_ms) {
+    // Blocking the main thread lets the ChibiOS idle thread drop the core into WFI until the timeout or a signal
+    chBSemWaitTimeout(&idle_wakeup_sem, TIME_MS2I(timeout_ms));
+}
+
+void idle_scheduler_wakeup_platform_from_isr(void) {
+    chSysLockFromISR();
+    chBSemSignalI(&idle_wakeup_sem);
+    chSysUnlockFromISR();
+}
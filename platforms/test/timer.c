@@ -16,10 +16,14 @@
 
 #include "timer.h"
 #include <stdatomic.h>
+#include <stdbool.h>
 
 static atomic_uint_least32_t current_time      = 0;
 static atomic_uint_least32_t async_tick_amount = 0;
 static atomic_uint_least32_t access_counter    = 0;
+static atomic_uint_least32_t wakeup_event_time = 0;
+static atomic_bool           wakeup_event_set  = false;
+static atomic_uint_least32_t last_sleep_amount = 0;
 
 void simulate_async_tick(uint32_t t) {
     async_tick_amount = t;
@@ -41,12 +45,16 @@ void timer_init(void) {
     current_time      = 0;
     async_tick_amount = 0;
     access_counter    = 0;
+    wakeup_event_set  = false;
+    last_sleep_amount = 0;
 }
 
 void timer_clear(void) {
     current_time      = 0;
     async_tick_amount = 0;
     access_counter    = 0;
+    wakeup_event_set  = false;
+    last_sleep_amount = 0;
 }
 
 uint16_t timer_read(void) {
@@ -73,3 +81,26 @@ void advance_time(uint32_t ms) {
 void wait_ms(uint32_t ms) {
     advance_time(ms);
 }
+
+void simulate_wakeup_event_in(uint32_t ms) {
+    wakeup_event_time = current_time + ms;
+    wakeup_event_set  = true;
+}
+
+uint32_t last_idle_sleep(void) {
+    return last_sleep_amount;
+}
+
+void idle_scheduler_sleep_platform(uint32_t timeout_ms) {
+    uint32_t amount = timeout_ms;
+    if (wakeup_event_set) {
+        int32_t remaining = (int32_t)(wakeup_event_time - current_time);
+        if (remaining < (int32_t)timeout_ms) {
+            // The simulated interrupt cuts the sleep short
+            amount           = remaining > 0 ? remaining : 0;
+            wakeup_event_set = false;
+        }
+    }
+    last_sleep_amount = amount;
+    advance_time(amount);
+}
@@ -81,6 +81,11 @@ void action_exec(keyevent_t event) {
         ac_dprintf("EVENT: ");
         debug_event(event);
         ac_dprintf("\n");
+#ifdef LATENCY_TRACE_ENABLE
+        if (IS_KEYEVENT(event)) {
+            latency_trace_key(event.key, event.pressed, LATENCY_STAGE_ACTION);
+        }
+#endif
 #if defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY) || (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
         uint16_t event_keycode = get_event_keycode(event, false);
         if (event.pressed) {
@@ -143,6 +148,10 @@ void action_exec(keyevent_t event) {
         dprintln();
     }
 #endif
+
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_complete();
+#endif
 }
 
 #ifdef SWAP_HANDS_ENABLE
@@ -282,6 +291,12 @@ void process_record(keyrecord_t *record) {
         return;
     }
 
+#ifdef LATENCY_TRACE_ENABLE
+    if (IS_KEYEVENT(record->event)) {
+        latency_trace_key(record->event.key, record->event.pressed, LATENCY_STAGE_RELEASE);
+    }
+#endif
+
     if (!process_record_quantum(record)) {
 #ifndef NO_ACTION_ONESHOT
         if (is_oneshot_layer_active() && record->event.pressed && keymap_config.oneshot_enable) {
@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -316,16 +317,15 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+#ifndef NO_ACTION_LAYER
+/** \brief Layer switch scan layers
  *
- * Gets the layer based on key info
+ * Finds the topmost non-transparent layer for the key within the supplied layer mask
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
-#ifndef NO_ACTION_LAYER
+static uint8_t layer_switch_scan_layers(keypos_t key, layer_state_t layers) {
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
-    layer_state_t layers = layer_state | default_layer_state;
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
@@ -337,6 +337,59 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     }
     /* fall back to layer 0 */
     return 0;
+}
+#endif
+
+#if defined(RESOLVED_LAYER_CACHE_ENABLE) && !defined(NO_ACTION_LAYER)
+/** \brief resolved layer cache
+ *
+ * Holds the result of the layer scan for each matrix position, for the layer mask it was built against.
+ */
+#    define RESOLVED_LAYER_UNKNOWN 0xFF
+
+static uint8_t       resolved_layer_cache[MATRIX_ROWS][MATRIX_COLS];
+static layer_state_t resolved_layer_cache_layers = 0;
+static bool          resolved_layer_cache_valid  = false;
+
+_Static_assert(sizeof(resolved_layer_cache) <= RESOLVED_LAYER_CACHE_MAX_BYTES, "Resolved layer cache exceeds RESOLVED_LAYER_CACHE_MAX_BYTES");
+_Static_assert(MAX_LAYER < RESOLVED_LAYER_UNKNOWN, "Resolved layer cache cannot represent MAX_LAYER");
+
+/** \brief Layer cache invalidate
+ *
+ * Discards all resolved layers, e.g. after a keymap entry has been rewritten
+ */
+void layer_cache_invalidate(void) {
+    resolved_layer_cache_valid = false;
+}
+#endif
+
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+#ifndef NO_ACTION_LAYER
+    layer_state_t layers = layer_state | default_layer_state;
+#    ifdef RESOLVED_LAYER_CACHE_ENABLE
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return layer_switch_scan_layers(key, layers);
+    }
+
+    /* layer state can be written directly (e.g. split sync), so compare rather than rely on setters */
+    if (!resolved_layer_cache_valid || resolved_layer_cache_layers != layers) {
+        memset(resolved_layer_cache, RESOLVED_LAYER_UNKNOWN, sizeof(resolved_layer_cache));
+        resolved_layer_cache_layers = layers;
+        resolved_layer_cache_valid  = true;
+    }
+
+    uint8_t *entry = &resolved_layer_cache[key.row][key.col];
+    if (*entry == RESOLVED_LAYER_UNKNOWN) {
+        *entry = layer_switch_scan_layers(key, layers);
+    }
+    return *entry;
+#    else
+    return layer_switch_scan_layers(key, layers);
+#    endif
 #else
     return get_highest_layer(default_layer_state);
 #endif
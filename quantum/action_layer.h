@@ -166,5 +166,17 @@ action_t store_or_get_action(bool pressed, keypos_t key);
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
+/* resolved layer cache, rebuilt lazily on layer state changes */
+#if defined(RESOLVED_LAYER_CACHE_ENABLE) && !defined(NO_ACTION_LAYER)
+#    ifndef RESOLVED_LAYER_CACHE_MAX_BYTES
+#        define RESOLVED_LAYER_CACHE_MAX_BYTES 1024
+#    endif
+
+/* must be called whenever the keymap contents change */
+void layer_cache_invalidate(void);
+#else
+#    define layer_cache_invalidate()
+#endif
+
 /* return action depending on current layer status */
 action_t layer_switch_get_action(keypos_t key);
@@ -105,10 +105,10 @@ static uint8_t     waiting_buffer_tail                 = 0;
 
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
-static void waiting_buffer_clear(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
 static void waiting_buffer_scan_tap(void);
+static void waiting_buffer_settle(void);
 static void debug_tapping_key(void);
 static void debug_waiting_buffer(void);
 
@@ -124,12 +124,10 @@ void action_tapping_process(keyrecord_t record) {
             ac_dprintf("\n");
         }
     } else {
-        if (!waiting_buffer_enq(record)) {
-            // clear all in case of overflow.
-            ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
-            clear_keyboard();
-            waiting_buffer_clear();
-            tapping_key = (keyrecord_t){0};
+        while (!waiting_buffer_enq(record)) {
+            // never drop events, settle early to make room instead
+            ac_dprintf("OVERFLOW: SETTLE EARLY\n");
+            waiting_buffer_settle();
         }
     }
 
@@ -589,13 +587,34 @@ bool waiting_buffer_enq(keyrecord_t record) {
     return true;
 }
 
-/** \brief Waiting buffer clear
+/** \brief Waiting buffer settle
  *
- * FIXME: Needs docs
+ * Forces the decision that is holding up the waiting buffer and releases as many queued events as
+ * possible. An undecided tapping key is settled as held, as if its tapping term had expired, since
+ * a full buffer means many keys were typed while it was held. Otherwise the oldest queued event is
+ * taken off the buffer and processed the same way as a new event. Either way at least one slot is freed.
  */
-void waiting_buffer_clear(void) {
-    waiting_buffer_head = 0;
-    waiting_buffer_tail = 0;
+void waiting_buffer_settle(void) {
+    if (IS_NOEVENT(tapping_key.event) || !tapping_key.event.pressed || tapping_key.tap.count != 0) {
+        // Only an undecided tapping key holds events back, so process_tapping() accepts this one and
+        // action_tapping_process() does not come back here
+        keyrecord_t record  = waiting_buffer[waiting_buffer_tail];
+        waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+        action_tapping_process(record);
+        return;
+    }
+
+    ac_dprintf("Tapping: End. Overflow. Not tap(0)\n");
+    process_record(&tapping_key);
+    tapping_key = (keyrecord_t){0};
+    debug_tapping_key();
+
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+        if (!process_tapping(&waiting_buffer[waiting_buffer_tail])) {
+            break;
+        }
+    }
+    debug_waiting_buffer();
 }
 
 /** \brief Waiting buffer typed
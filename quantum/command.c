@@ -47,6 +47,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "audio.h"
 #endif /* AUDIO_ENABLE */
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
 static bool command_common(uint8_t code);
 static void command_common_help(void);
 static void print_version(void);
@@ -157,6 +161,10 @@ static void command_common_help(void) {
 #ifdef SLEEP_LED_ENABLE
         STR(MAGIC_KEY_SLEEP_LED) ":	Sleep LED Test\n"
 #endif
+
+#ifdef LATENCY_TRACE_ENABLE
+        STR(MAGIC_KEY_LATENCY_TRACE) ":	Print and Clear Latency Trace\n"
+#endif
     ); /* clang-format on */
 }
 
@@ -330,6 +338,15 @@ static bool command_common(uint8_t code) {
             break;
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+
+        // dump the latency histograms and start a new measurement
+        case MAGIC_KC(MAGIC_KEY_LATENCY_TRACE):
+            latency_trace_print();
+            latency_trace_clear();
+            break;
+#endif
+
         // print stored eeprom config
         case MAGIC_KC(MAGIC_KEY_EEPROM):
 #if !defined(NO_PRINT) && !defined(USER_PRINT)
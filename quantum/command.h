@@ -158,5 +158,9 @@ bool command_proc(uint8_t code);
 
 #endif
 
+#ifndef MAGIC_KEY_LATENCY_TRACE
+#    define MAGIC_KEY_LATENCY_TRACE T
+#endif
+
 #define XMAGIC_KC(key) KC_##key
 #define MAGIC_KC(key) XMAGIC_KC(key)
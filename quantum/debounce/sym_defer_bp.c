@@ -0,0 +1,185 @@
+/*
+Copyright 2017 Alex Ong<the.onga@gmail.com>
+Copyright 2020 Andrei Purdea<andrei@purdea.ro>
+Copyright 2021 Simon Arlott
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Symmetric per-key algorithm with the same behaviour as sym_defer_pk.
+The counters are stored as bit-planes: plane N of a row holds bit N of the counter
+of every key in that row, so a whole row is counted down with a few bitwise
+operations instead of one subtraction per key.
+When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+#include <string.h>
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+// Number of bit-planes needed to hold DEBOUNCE
+#if DEBOUNCE < 2
+#    define DEBOUNCE_PLANES 1
+#elif DEBOUNCE < 4
+#    define DEBOUNCE_PLANES 2
+#elif DEBOUNCE < 8
+#    define DEBOUNCE_PLANES 3
+#elif DEBOUNCE < 16
+#    define DEBOUNCE_PLANES 4
+#elif DEBOUNCE < 32
+#    define DEBOUNCE_PLANES 5
+#elif DEBOUNCE < 64
+#    define DEBOUNCE_PLANES 6
+#elif DEBOUNCE < 128
+#    define DEBOUNCE_PLANES 7
+#else
+#    define DEBOUNCE_PLANES 8
+#endif
+
+#if DEBOUNCE > 0
+static matrix_row_t debounce_counters[MATRIX_ROWS][DEBOUNCE_PLANES];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    memset(debounce_counters, 0, sizeof(debounce_counters));
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+// Keys in the row with a counter running
+static inline matrix_row_t active_keys(const matrix_row_t planes[]) {
+    matrix_row_t active = 0;
+    for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+        active |= planes[bit];
+    }
+    return active;
+}
+
+// Subtract elapsed_time from every counter in the row, returning the active keys that have expired.
+static matrix_row_t count_down(matrix_row_t planes[], matrix_row_t active, uint8_t elapsed_time) {
+    // Counters never exceed DEBOUNCE, so all of them expire
+    if (elapsed_time > DEBOUNCE) {
+        memset(planes, 0, DEBOUNCE_PLANES * sizeof(matrix_row_t));
+        return active;
+    }
+
+    matrix_row_t borrow  = 0;
+    matrix_row_t nonzero = 0;
+    for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+        matrix_row_t plane = planes[bit];
+        if (elapsed_time & (1 << bit)) {
+            planes[bit] = ~plane ^ borrow;
+            borrow      = ~plane | borrow;
+        } else {
+            planes[bit] = plane ^ borrow;
+            borrow      = ~plane & borrow;
+        }
+        nonzero |= planes[bit];
+    }
+
+    // A borrow out of the top plane or a zero result means the counter was <= elapsed_time
+    matrix_row_t expired = active & (borrow | ~nonzero);
+    for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+        planes[bit] &= active & ~expired;
+    }
+    return expired;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t active = active_keys(debounce_counters[row]);
+        if (!active) {
+            continue;
+        }
+
+        matrix_row_t expired = count_down(debounce_counters[row], active, elapsed_time);
+        if (expired) {
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+        if (active & ~expired) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *planes = debounce_counters[row];
+        matrix_row_t  delta  = raw[row] ^ cooked[row];
+        matrix_row_t  start  = delta & ~active_keys(planes);
+
+        // Keys that changed back stop counting, newly changed keys start at DEBOUNCE
+        for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+            planes[bit] &= delta;
+            if (DEBOUNCE & (1 << bit)) {
+                planes[bit] |= start;
+            }
+        }
+        if (start) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+extern "C" {
+#include "debounce.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/* Scans the whole matrix once per millisecond while keys are pressed, released and chatter, the way matrix_scan() would.
+ * The same fixed seed is used for every algorithm so that their scan costs can be compared directly. */
+class DebounceBenchmark : public ::testing::Test {
+   protected:
+    uint32_t seed_ = 0x2545F491;
+
+    uint32_t next(uint32_t range) {
+        seed_ = seed_ * 1103515245 + 12345;
+        return (seed_ >> 16) % range;
+    }
+
+    void run_benchmark(uint32_t duration, uint32_t event_interval) {
+        matrix_row_t switches[MATRIX_ROWS] = {0};
+        matrix_row_t raw[MATRIX_ROWS]      = {0};
+        matrix_row_t cooked[MATRIX_ROWS]   = {0};
+        uint8_t      bounce_row            = 0;
+        matrix_row_t bounce_mask           = 0;
+        uint32_t     bounces               = 0;
+        uint32_t     transitions           = 0;
+
+        debounce_init(MATRIX_ROWS);
+        set_time(1000);
+
+        std::chrono::nanoseconds elapsed(0);
+        for (uint32_t now = 0; now < duration; now++) {
+            /* A switch changes state, then chatters for a few scans */
+            if (next(event_interval) == 0) {
+                bounce_row  = next(MATRIX_ROWS);
+                bounce_mask = (matrix_row_t)1 << next(MATRIX_COLS);
+                bounces     = next(4) * 2;
+                switches[bounce_row] ^= bounce_mask;
+            }
+
+            matrix_row_t previous[MATRIX_ROWS];
+            std::copy(std::begin(raw), std::end(raw), std::begin(previous));
+            std::copy(std::begin(switches), std::end(switches), std::begin(raw));
+            if (bounces > 0) {
+                raw[bounce_row] ^= (bounces-- % 2) ? bounce_mask : 0;
+            }
+            bool changed = !std::equal(std::begin(raw), std::end(raw), std::begin(previous));
+
+            matrix_row_t before[MATRIX_ROWS];
+            std::copy(std::begin(cooked), std::end(cooked), std::begin(before));
+
+            auto start = std::chrono::steady_clock::now();
+            debounce(raw, cooked, MATRIX_ROWS, changed);
+            elapsed += std::chrono::steady_clock::now() - start;
+
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                transitions += __builtin_popcountll(before[row] ^ cooked[row]);
+            }
+            advance_time(1);
+        }
+
+        /* Stop any chatter and let every counter expire, after which the debounced matrix must match the switches */
+        bool changed = !std::equal(std::begin(raw), std::end(raw), std::begin(switches));
+        std::copy(std::begin(switches), std::end(switches), std::begin(raw));
+        for (uint16_t i = 0; i <= UINT8_MAX; i++) {
+            debounce(raw, cooked, MATRIX_ROWS, changed);
+            changed = false;
+            advance_time(1);
+        }
+        EXPECT_TRUE(std::equal(std::begin(cooked), std::end(cooked), std::begin(switches))) << "debounced matrix did not settle";
+        EXPECT_GT(transitions, 0);
+        debounce_free();
+
+        std::cout << "debounce [" << DEBOUNCE_BENCHMARK_TYPE << ", " << MATRIX_ROWS << "x" << MATRIX_COLS << "]: " << elapsed.count() / duration << "ns/scan with a change every " << event_interval << "ms, " << transitions << " transitions" << std::endl;
+    }
+};
+
+TEST_F(DebounceBenchmark, Idle) {
+    run_benchmark(60000, 60000);
+}
+
+TEST_F(DebounceBenchmark, Typing) {
+    run_benchmark(60000, 40);
+}
+
+TEST_F(DebounceBenchmark, Rollover) {
+    run_benchmark(60000, 2);
+}
@@ -34,6 +34,11 @@ debounce_sym_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
 
+debounce_sym_defer_bp_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_bp_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_bp.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
+
 debounce_sym_defer_pr_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_defer_pr_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pr.c \
@@ -44,6 +49,11 @@ debounce_sym_eager_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_eager_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_eager_pk_tests.cpp
 
+debounce_sym_eager_bp_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_eager_bp_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_bp.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_eager_pk_tests.cpp
+
 debounce_sym_eager_pr_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_eager_pr_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_eager_pr.c \
@@ -53,3 +63,26 @@ debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
 	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+
+# Scan cost on a 2x 8x16 split, comparing the per-key counters with the bit-plane counters
+DEBOUNCE_BENCHMARK_DEFS := -DMATRIX_ROWS=16 -DMATRIX_COLS=16 -DDEBOUNCE=5
+
+DEBOUNCE_BENCHMARK_SRC := $(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+debounce_benchmark_sym_defer_pk_DEFS := $(DEBOUNCE_BENCHMARK_DEFS) -DDEBOUNCE_BENCHMARK_TYPE=\"sym_defer_pk\"
+debounce_benchmark_sym_defer_pk_SRC := $(DEBOUNCE_BENCHMARK_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c
+
+debounce_benchmark_sym_defer_bp_DEFS := $(DEBOUNCE_BENCHMARK_DEFS) -DDEBOUNCE_BENCHMARK_TYPE=\"sym_defer_bp\"
+debounce_benchmark_sym_defer_bp_SRC := $(DEBOUNCE_BENCHMARK_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_bp.c
+
+debounce_benchmark_sym_eager_pk_DEFS := $(DEBOUNCE_BENCHMARK_DEFS) -DDEBOUNCE_BENCHMARK_TYPE=\"sym_eager_pk\"
+debounce_benchmark_sym_eager_pk_SRC := $(DEBOUNCE_BENCHMARK_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_pk.c
+
+debounce_benchmark_sym_eager_bp_DEFS := $(DEBOUNCE_BENCHMARK_DEFS) -DDEBOUNCE_BENCHMARK_TYPE=\"sym_eager_bp\"
+debounce_benchmark_sym_eager_bp_SRC := $(DEBOUNCE_BENCHMARK_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_bp.c
@@ -4,6 +4,9 @@
 #include <stddef.h>
 #include <timer.h>
 #include <deferred_exec.h>
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
 
 #ifndef MAX_DEFERRED_EXECUTORS
 #    define MAX_DEFERRED_EXECUTORS 8
@@ -64,6 +67,9 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
             entry->trigger_time = timer_read32() + delay_ms;
             entry->callback     = callback;
             entry->cb_arg       = cb_arg;
+#ifdef IDLE_SCHEDULER_ENABLE
+            idle_scheduler_request_wakeup(entry->trigger_time);
+#endif
             return current_token;
         }
     }
@@ -152,6 +158,13 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
                     entry->cb_arg       = NULL;
                 }
             }
+
+#ifdef IDLE_SCHEDULER_ENABLE
+            // Make sure the main loop is awake for the next invocation
+            if (entry->token != INVALID_DEFERRED_TOKEN) {
+                idle_scheduler_request_wakeup(entry->trigger_time);
+            }
+#endif
         }
     }
 }
@@ -17,10 +17,12 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "eeprom.h"
 #include "progmem.h"
 #include "send_string.h"
 #include "keycodes.h"
+#include "timer.h"
 
 #ifdef VIA_ENABLE
 #    include "via.h"
@@ -101,6 +103,101 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#define DYNAMIC_KEYMAP_KEYMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+#ifdef ENCODER_MAP_ENABLE
+#    define DYNAMIC_KEYMAP_ENCODERMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2 * 2)
+#else
+#    define DYNAMIC_KEYMAP_ENCODERMAP_SIZE 0
+#endif
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// Writes are held in RAM until no further writes have happened for this long
+#    ifndef DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY
+#        define DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY 1000
+#    endif
+
+// Mirror of the keymap followed by the encoder map, in the same big-endian layout as EEPROM
+#    define DYNAMIC_KEYMAP_RAM_CACHE_SIZE (DYNAMIC_KEYMAP_KEYMAP_SIZE + DYNAMIC_KEYMAP_ENCODERMAP_SIZE)
+
+static uint8_t  dynamic_keymap_cache[DYNAMIC_KEYMAP_RAM_CACHE_SIZE];
+static uint8_t  dynamic_keymap_cache_dirty[(DYNAMIC_KEYMAP_RAM_CACHE_SIZE / 2 + 7) / 8];
+static bool     dynamic_keymap_cache_loaded  = false;
+static bool     dynamic_keymap_cache_pending = false;
+static uint32_t dynamic_keymap_cache_last_write;
+
+static void *dynamic_keymap_cache_to_eeprom_address(uint16_t index) {
+    if (index < DYNAMIC_KEYMAP_KEYMAP_SIZE) {
+        return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + index;
+    }
+    return ((void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR) + (index - DYNAMIC_KEYMAP_KEYMAP_SIZE);
+}
+
+// Loaded on first use, so that resets performed before this point are not clobbered
+static inline void dynamic_keymap_cache_load(void) {
+    if (dynamic_keymap_cache_loaded) {
+        return;
+    }
+    eeprom_read_block(dynamic_keymap_cache, (void *)DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_KEYMAP_SIZE);
+#    ifdef ENCODER_MAP_ENABLE
+    eeprom_read_block(dynamic_keymap_cache + DYNAMIC_KEYMAP_KEYMAP_SIZE, (void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR, DYNAMIC_KEYMAP_ENCODERMAP_SIZE);
+#    endif
+    dynamic_keymap_cache_loaded = true;
+}
+
+static inline uint8_t dynamic_keymap_cache_read_byte(uint16_t index) {
+    dynamic_keymap_cache_load();
+    return dynamic_keymap_cache[index];
+}
+
+static void dynamic_keymap_cache_write_byte(uint16_t index, uint8_t value) {
+    dynamic_keymap_cache_load();
+    dynamic_keymap_cache[index] = value;
+    // Always mark dirty, EEPROM may have been formatted underneath the cache
+    dynamic_keymap_cache_dirty[index / 16] |= 1 << ((index / 2) % 8);
+    dynamic_keymap_cache_pending    = true;
+    dynamic_keymap_cache_last_write = timer_read32();
+}
+
+void dynamic_keymap_flush(void) {
+    if (!dynamic_keymap_cache_pending) {
+        return;
+    }
+    for (uint16_t i = 0; i < sizeof(dynamic_keymap_cache_dirty); i++) {
+        if (!dynamic_keymap_cache_dirty[i]) {
+            continue;
+        }
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            if (dynamic_keymap_cache_dirty[i] & (1 << bit)) {
+                uint16_t index   = (i * 8 + bit) * 2;
+                void *   address = dynamic_keymap_cache_to_eeprom_address(index);
+                eeprom_update_byte(address, dynamic_keymap_cache[index]);
+                eeprom_update_byte(address + 1, dynamic_keymap_cache[index + 1]);
+            }
+        }
+        dynamic_keymap_cache_dirty[i] = 0;
+    }
+    dynamic_keymap_cache_pending = false;
+}
+
+bool dynamic_keymap_flush_pending(void) {
+    return dynamic_keymap_cache_pending;
+}
+
+void dynamic_keymap_task(void) {
+    if (dynamic_keymap_cache_pending && timer_elapsed32(dynamic_keymap_cache_last_write) >= DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY) {
+        dynamic_keymap_flush();
+    }
+}
+#else
+void dynamic_keymap_flush(void) {}
+
+bool dynamic_keymap_flush_pending(void) {
+    return false;
+}
+
+void dynamic_keymap_task(void) {}
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -112,19 +209,32 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    uint16_t index   = (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+    uint16_t keycode = dynamic_keymap_cache_read_byte(index) << 8;
+    keycode |= dynamic_keymap_cache_read_byte(index + 1);
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
+#endif
     return keycode;
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    uint16_t index = (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+    dynamic_keymap_cache_write_byte(index, (uint8_t)(keycode >> 8));
+    dynamic_keymap_cache_write_byte(index + 1, (uint8_t)(keycode & 0xFF));
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#endif
+    layer_cache_invalidate();
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -134,19 +244,31 @@ void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id
 
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    uint16_t index   = DYNAMIC_KEYMAP_KEYMAP_SIZE + (layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2) + (clockwise ? 0 : 2);
+    uint16_t keycode = ((uint16_t)dynamic_keymap_cache_read_byte(index)) << 8;
+    keycode |= dynamic_keymap_cache_read_byte(index + 1);
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
     keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
+#    endif
     return keycode;
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    uint16_t index = DYNAMIC_KEYMAP_KEYMAP_SIZE + (layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2) + (clockwise ? 0 : 2);
+    dynamic_keymap_cache_write_byte(index, (uint8_t)(keycode >> 8));
+    dynamic_keymap_cache_write_byte(index + 1, (uint8_t)(keycode & 0xFF));
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+#    endif
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -165,9 +287,16 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+    // Callers mark EEPROM valid straight after resetting, so don't leave this pending
+    dynamic_keymap_flush();
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    for (uint16_t i = 0; i < size; i++) {
+        data[i] = (offset + i < DYNAMIC_KEYMAP_KEYMAP_SIZE) ? dynamic_keymap_cache_read_byte(offset + i) : 0x00;
+    }
+#else
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
     void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *target                     = data;
@@ -180,9 +309,15 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
         source++;
         target++;
     }
+#endif
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    for (uint16_t i = 0; i < size && offset + i < DYNAMIC_KEYMAP_KEYMAP_SIZE; i++) {
+        dynamic_keymap_cache_write_byte(offset + i, data[i]);
+    }
+#else
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
     void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *source                     = data;
@@ -193,6 +328,8 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
         source++;
         target++;
     }
+#endif
+    layer_cache_invalidate();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -220,7 +357,7 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -234,7 +371,11 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+#ifdef SENDSTRING_ASYNC
+    // Queued macros read the buffer as they are typed, so stop them before it changes underneath them
+    send_string_async_cancel();
+#endif
+    void *   target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *source = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -257,6 +398,9 @@ char send_string_get_next_eeprom(void *arg) {
 }
 
 void dynamic_keymap_macro_reset(void) {
+#ifdef SENDSTRING_ASYNC
+    send_string_async_cancel();
+#endif
     void *p   = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
     void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
     while (p != end) {
@@ -296,5 +440,9 @@ void dynamic_keymap_macro_send(uint8_t id) {
     }
 
     send_string_eeprom_state_t state = {p};
+#ifdef SENDSTRING_ASYNC
+    send_string_async_impl(send_string_get_next_eeprom, &state, sizeof(state), DYNAMIC_KEYMAP_MACRO_DELAY);
+#else
     send_string_with_delay_impl(send_string_get_next_eeprom, &state, DYNAMIC_KEYMAP_MACRO_DELAY);
+#endif
 }
@@ -38,6 +38,13 @@ void dynamic_keymap_reset(void);
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 
+// With DYNAMIC_KEYMAP_RAM_CACHE, keymap and encoder map reads are served from a RAM mirror
+// and writes are batched, reaching EEPROM once DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY ms have
+// passed without further writes. dynamic_keymap_flush() forces pending writes out immediately.
+void dynamic_keymap_flush(void);
+bool dynamic_keymap_flush_pending(void);
+void dynamic_keymap_task(void);
+
 // This overrides the one in quantum/keymap_common.c
 // uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
 
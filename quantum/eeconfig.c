@@ -65,6 +65,12 @@ void eeconfig_init_quantum(void) {
 #if defined(HAPTIC_ENABLE)
     haptic_reset();
 #endif
+#ifdef MATRIX_SETTLE_CALIBRATION
+    // Recalibrate on the next boot
+    uint8_t matrix_settle[MATRIX_SETTLE_LINES];
+    memset(matrix_settle, MATRIX_SETTLE_UNCALIBRATED, sizeof(matrix_settle));
+    eeconfig_update_matrix_settle(matrix_settle);
+#endif
 
 #if (EECONFIG_KB_DATA_SIZE) > 0
     eeconfig_init_kb_datablock();
@@ -280,6 +286,23 @@ void eeconfig_update_handedness(bool val) {
     eeprom_update_byte(EECONFIG_HANDEDNESS, !!val);
 }
 
+#ifdef MATRIX_SETTLE_CALIBRATION
+/** \brief eeconfig read matrix settle delays
+ *
+ * Reads the calibrated delay of each matrix line, in microseconds.
+ */
+void eeconfig_read_matrix_settle(uint8_t *settle) {
+    eeprom_read_block(settle, EECONFIG_MATRIX_SETTLE, MATRIX_SETTLE_LINES);
+}
+/** \brief eeconfig update matrix settle delays
+ *
+ * Stores the calibrated delay of each matrix line, in microseconds.
+ */
+void eeconfig_update_matrix_settle(const uint8_t *settle) {
+    eeprom_update_block(settle, EECONFIG_MATRIX_SETTLE, MATRIX_SETTLE_LINES);
+}
+#endif
+
 #if (EECONFIG_KB_DATA_SIZE) > 0
 /** \brief eeconfig assert keyboard data block version
  *
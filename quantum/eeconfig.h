@@ -23,6 +23,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "eeprom.h"
 #include "util.h"
 #include "action_layer.h" // layer_state_t
+#ifdef MATRIX_SETTLE_CALIBRATION
+#    include "matrix.h" // MATRIX_SETTLE_LINES
+#endif
 
 #ifndef EECONFIG_MAGIC_NUMBER
 #    define EECONFIG_MAGIC_NUMBER (uint16_t)0xFEE5 // When changing, decrement this value to avoid future re-init issues
@@ -49,6 +52,9 @@ typedef struct PACKED {
     };
     uint32_t haptic;
     uint8_t  rgblight_ext;
+#ifdef MATRIX_SETTLE_CALIBRATION
+    uint8_t  matrix_settle[MATRIX_SETTLE_LINES];
+#endif
 } eeprom_core_t;
 
 /* EEPROM parameter address */
@@ -68,6 +74,9 @@ typedef struct PACKED {
 #define EECONFIG_RGB_MATRIX (uint64_t *)(offsetof(eeprom_core_t, rgb_matrix))
 #define EECONFIG_HAPTIC (uint32_t *)(offsetof(eeprom_core_t, haptic))
 #define EECONFIG_RGBLIGHT_EXTENDED (uint8_t *)(offsetof(eeprom_core_t, rgblight_ext))
+#ifdef MATRIX_SETTLE_CALIBRATION
+#    define EECONFIG_MATRIX_SETTLE (uint8_t *)(offsetof(eeprom_core_t, matrix_settle))
+#endif
 
 // Size of EEPROM being used for core data storage
 #define EECONFIG_BASE_SIZE ((uint8_t)sizeof(eeprom_core_t))
@@ -152,6 +161,11 @@ void     eeconfig_update_haptic(uint32_t val);
 bool eeconfig_read_handedness(void);
 void eeconfig_update_handedness(bool val);
 
+#ifdef MATRIX_SETTLE_CALIBRATION
+void eeconfig_read_matrix_settle(uint8_t *settle);
+void eeconfig_update_matrix_settle(const uint8_t *settle);
+#endif
+
 #if (EECONFIG_KB_DATA_SIZE) > 0
 bool eeconfig_is_kb_datablock_valid(void);
 void eeconfig_read_kb_datablock(void *data);
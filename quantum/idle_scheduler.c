@@ -0,0 +1,112 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "idle_scheduler.h"
+#include "keyboard.h"
+#include "matrix.h"
+#include "timer.h"
+
+static uint32_t      deadlines[IDLE_SCHEDULER_MAX_DEADLINES];
+static uint8_t       deadline_count  = 0;
+static uint32_t      iteration_start = 0;
+static volatile bool wakeup_pending  = false;
+
+//------------------------------------
+// Platform hooks
+//
+
+__attribute__((weak)) void idle_scheduler_sleep_platform(uint32_t timeout_ms) {}
+__attribute__((weak)) void idle_scheduler_wakeup_platform_from_isr(void) {}
+
+//------------------------------------
+// Deadline tracking
+//
+
+static inline int32_t deadline_remaining(uint32_t deadline, uint32_t now) {
+    return (int32_t)TIMER_DIFF_32(deadline, now);
+}
+
+void idle_scheduler_request_wakeup(uint32_t deadline) {
+    uint8_t latest = 0;
+    for (uint8_t i = 0; i < deadline_count; i++) {
+        if (deadlines[i] == deadline) {
+            return;
+        }
+        if (deadline_remaining(deadlines[i], deadlines[latest]) > 0) {
+            latest = i;
+        }
+    }
+
+    if (deadline_count < IDLE_SCHEDULER_MAX_DEADLINES) {
+        deadlines[deadline_count++] = deadline;
+    } else if (deadline_remaining(deadline, deadlines[latest]) < 0) {
+        // Out of slots, so drop the latest -- it is served late by at most IDLE_SCHEDULER_MAX_SLEEP_MS
+        deadlines[latest] = deadline;
+    }
+}
+
+void idle_scheduler_request_wakeup_in(uint32_t delay_ms) {
+    idle_scheduler_request_wakeup(timer_read32() + delay_ms);
+}
+
+void idle_scheduler_keep_awake(void) {
+    idle_scheduler_request_wakeup(timer_read32());
+}
+
+void idle_scheduler_wakeup_from_isr(void) {
+    wakeup_pending = true;
+    idle_scheduler_wakeup_platform_from_isr();
+}
+
+static bool matrix_has_keys_down(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (matrix_get_row(row)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t idle_scheduler_sleep_duration(void) {
+    if (wakeup_pending) {
+        return 0;
+    }
+
+    // Held keys and recent activity need every scan for debounce and tapping decisions
+    if (matrix_has_keys_down() || last_input_activity_elapsed() < IDLE_SCHEDULER_ACTIVE_TIMEOUT) {
+        return 0;
+    }
+
+    uint32_t now      = timer_read32();
+    uint32_t duration = IDLE_SCHEDULER_MAX_SLEEP_MS;
+    for (uint8_t i = 0; i < deadline_count; i++) {
+        int32_t remaining = deadline_remaining(deadlines[i], now);
+        if (remaining <= 0) {
+            return 0;
+        }
+        if ((uint32_t)remaining < duration) {
+            duration = remaining;
+        }
+    }
+    return duration;
+}
+
+void idle_scheduler_task(void) {
+    // Every deadline that had passed when this iteration started has now been serviced by the loop body
+    for (uint8_t i = 0; i < deadline_count;) {
+        if (deadline_remaining(deadlines[i], iteration_start) <= 0) {
+            deadlines[i] = deadlines[--deadline_count];
+        } else {
+            i++;
+        }
+    }
+
+    // Consume the interrupt that forced this iteration
+    uint32_t duration = idle_scheduler_sleep_duration();
+    wakeup_pending    = false;
+
+    if (duration > 0) {
+        idle_scheduler_sleep_platform(duration);
+    }
+    iteration_start = timer_read32();
+}
@@ -0,0 +1,81 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @def The maximum number of milliseconds the main loop is allowed to sleep when nothing is pending. This bounds the
+ *      latency of a keypress when the board has no GPIO interrupt wired up to `idle_scheduler_wakeup_from_isr()`.
+ */
+#ifndef IDLE_SCHEDULER_MAX_SLEEP_MS
+#    define IDLE_SCHEDULER_MAX_SLEEP_MS 10
+#endif
+
+/**
+ * @def The number of milliseconds after the last input activity during which the main loop keeps spinning at full
+ *      rate. This covers tapping, combo, tap dance and leader timeouts without each of them having to report deadlines.
+ */
+#ifndef IDLE_SCHEDULER_ACTIVE_TIMEOUT
+#    define IDLE_SCHEDULER_ACTIVE_TIMEOUT 1000
+#endif
+
+/**
+ * @def The number of distinct wakeup deadlines that can be outstanding at once. When all of them are in use, the latest
+ *      one is dropped in favour of an earlier request, delaying it by at most `IDLE_SCHEDULER_MAX_SLEEP_MS`.
+ */
+#ifndef IDLE_SCHEDULER_MAX_DEADLINES
+#    define IDLE_SCHEDULER_MAX_DEADLINES 8
+#endif
+
+/**
+ * Requests that the main loop is running no later than the supplied time. Every outstanding request is honoured, and
+ * requests persist until their deadline has passed -- spurious wakeups are harmless, so stale requests never need to
+ * be withdrawn.
+ *
+ * @param deadline[in] the absolute wakeup time -- equivalent time-space as timer_read32()
+ */
+void idle_scheduler_request_wakeup(uint32_t deadline);
+
+/**
+ * Requests that the main loop is running no later than the supplied number of milliseconds from now.
+ *
+ * @param delay_ms[in] the number of milliseconds until the wakeup
+ */
+void idle_scheduler_request_wakeup_in(uint32_t delay_ms);
+
+/**
+ * Prevents the main loop from sleeping after the current iteration.
+ */
+void idle_scheduler_keep_awake(void);
+
+/**
+ * Signals an external event, such as a matrix GPIO interrupt. Safe to call from interrupt context. Aborts any sleep in
+ * progress and guarantees at least one full main loop iteration afterwards.
+ */
+void idle_scheduler_wakeup_from_isr(void);
+
+/**
+ * Works out how long the main loop may currently sleep for.
+ *
+ * @return the number of milliseconds the main loop may sleep, or zero if it needs to keep running
+ */
+uint32_t idle_scheduler_sleep_duration(void);
+
+/**
+ * Forward declaration for the main loop in order to sleep until the next wakeup. Should not be invoked by keyboard/user code.
+ */
+void idle_scheduler_task(void);
+
+/**
+ * Platform hook: blocks for at most the supplied number of milliseconds, returning early if
+ * `idle_scheduler_wakeup_platform_from_isr()` is invoked.
+ */
+void idle_scheduler_sleep_platform(uint32_t timeout_ms);
+
+/**
+ * Platform hook: aborts a sleep in progress inside `idle_scheduler_sleep_platform()`. Invoked from interrupt context.
+ */
+void idle_scheduler_wakeup_platform_from_isr(void);
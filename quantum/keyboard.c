@@ -83,6 +83,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef SECURE_ENABLE
 #    include "secure.h"
 #endif
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 #ifdef POINTING_DEVICE_ENABLE
 #    include "pointing_device.h"
 #endif
@@ -104,9 +107,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
+#ifdef SEND_STRING_ENABLE
+#    include "send_string.h"
+#endif
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
@@ -528,6 +537,9 @@ void keyboard_init(void) {
 #ifdef HAPTIC_ENABLE
     haptic_init();
 #endif
+#ifdef COMBO_ENABLE
+    combo_init();
+#endif
 
 #if defined(DEBUG_MATRIX_SCAN_RATE) && defined(CONSOLE_ENABLE)
     debug_enable = true;
@@ -612,6 +624,9 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
+#ifdef LATENCY_TRACE_ENABLE
+                    latency_trace_key(MAKE_KEYPOS(row, col), key_pressed, LATENCY_STAGE_DEBOUNCE);
+#endif
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
                 }
 
@@ -702,6 +717,10 @@ void quantum_task(void) {
 #ifdef LAYER_LOCK_ENABLE
     layer_lock_task();
 #endif
+
+#if defined(SEND_STRING_ENABLE) && defined(SENDSTRING_ASYNC)
+    send_string_async_task();
+#endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
@@ -795,4 +814,12 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_task();
+#endif
+
+#ifdef EEPROM_DRIVER
+    eeprom_driver_task();
+#endif
 }
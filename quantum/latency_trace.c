@@ -0,0 +1,217 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "latency_trace.h"
+#include "print.h"
+#include "timer.h"
+
+#define STAGE_BIT(stage) ((uint8_t)(1 << (stage)))
+
+static latency_trace_t in_flight[LATENCY_TRACE_IN_FLIGHT];
+static latency_trace_t completed[LATENCY_TRACE_BUFFER_SIZE];
+static uint8_t         completed_head  = 0;
+static uint8_t         completed_count = 0;
+static uint16_t        histograms[LATENCY_STAGE_COUNT + 1][LATENCY_TRACE_HISTOGRAM_BUCKETS];
+static uint16_t        dropped = 0;
+static matrix_row_t    raw_previous[MATRIX_ROWS];
+
+__attribute__((weak)) uint32_t latency_trace_timestamp(void) {
+    return timer_read32();
+}
+
+void latency_trace_clear(void) {
+    memset(in_flight, 0, sizeof(in_flight));
+    memset(histograms, 0, sizeof(histograms));
+    completed_head  = 0;
+    completed_count = 0;
+    dropped         = 0;
+}
+
+//------------------------------------
+// Traces in flight
+//
+
+static inline bool same_event(const latency_trace_t *trace, keypos_t key, bool pressed) {
+    return trace->stamped && trace->key.row == key.row && trace->key.col == key.col && trace->pressed == pressed;
+}
+
+static uint32_t first_stamp(const latency_trace_t *trace) {
+    for (uint8_t stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+        if (trace->stamped & STAGE_BIT(stage)) {
+            return trace->time[stage];
+        }
+    }
+    return 0;
+}
+
+static latency_trace_t *start_trace(keypos_t key, bool pressed, uint32_t now) {
+    latency_trace_t *slot = NULL;
+    for (uint8_t i = 0; i < LATENCY_TRACE_IN_FLIGHT; i++) {
+        latency_trace_t *trace = &in_flight[i];
+        if (!trace->stamped) {
+            if (!slot || slot->stamped) {
+                slot = trace;
+            }
+        } else if (same_event(trace, key, pressed)) {
+            // A repeat of the same transition supersedes the previous one, which never made it through
+            slot = trace;
+            break;
+        } else if (!slot || (slot->stamped && TIMER_DIFF_32(now, first_stamp(trace)) > TIMER_DIFF_32(now, first_stamp(slot)))) {
+            slot = trace;
+        }
+    }
+
+    if (slot->stamped) {
+        dropped++;
+    }
+    slot->key     = key;
+    slot->pressed = pressed;
+    slot->stamped = 0;
+    return slot;
+}
+
+static latency_trace_t *find_trace(keypos_t key, bool pressed, latency_stage_t stage) {
+    for (uint8_t i = 0; i < LATENCY_TRACE_IN_FLIGHT; i++) {
+        if (same_event(&in_flight[i], key, pressed) && !(in_flight[i].stamped & STAGE_BIT(stage))) {
+            return &in_flight[i];
+        }
+    }
+    return NULL;
+}
+
+static void stamp(latency_trace_t *trace, latency_stage_t stage, uint32_t now) {
+    trace->time[stage] = now;
+    trace->stamped |= STAGE_BIT(stage);
+}
+
+void latency_trace_raw_matrix(const matrix_row_t *raw, uint8_t first_row, uint8_t rows) {
+    uint32_t now = latency_trace_timestamp();
+    for (uint8_t i = 0; i < rows; i++) {
+        const uint8_t      row     = first_row + i;
+        const matrix_row_t changes = raw[i] ^ raw_previous[row];
+        if (!changes) {
+            continue;
+        }
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (changes & (MATRIX_ROW_SHIFTER << col)) {
+                const bool pressed = raw[i] & (MATRIX_ROW_SHIFTER << col);
+                stamp(start_trace(MAKE_KEYPOS(row, col), pressed, now), LATENCY_STAGE_MATRIX, now);
+            }
+        }
+        raw_previous[row] = raw[i];
+    }
+}
+
+void latency_trace_key(keypos_t key, bool pressed, latency_stage_t stage) {
+    uint32_t         now   = latency_trace_timestamp();
+    latency_trace_t *trace = find_trace(key, pressed, stage);
+    if (!trace) {
+        if (stage > LATENCY_STAGE_ACTION) {
+            // Synthesized events are not traced
+            return;
+        }
+        trace = start_trace(key, pressed, now);
+    }
+    stamp(trace, stage, now);
+}
+
+void latency_trace_hold(keypos_t key, bool pressed) {
+    for (uint8_t i = 0; i < LATENCY_TRACE_IN_FLIGHT; i++) {
+        if (same_event(&in_flight[i], key, pressed)) {
+            in_flight[i].stamped &= ~STAGE_BIT(LATENCY_STAGE_RELEASE);
+        }
+    }
+}
+
+void latency_trace_report(void) {
+    uint32_t now = latency_trace_timestamp();
+    for (uint8_t i = 0; i < LATENCY_TRACE_IN_FLIGHT; i++) {
+        latency_trace_t *trace = &in_flight[i];
+        if ((trace->stamped & (STAGE_BIT(LATENCY_STAGE_RELEASE) | STAGE_BIT(LATENCY_STAGE_REPORT))) == STAGE_BIT(LATENCY_STAGE_RELEASE)) {
+            stamp(trace, LATENCY_STAGE_REPORT, now);
+        }
+    }
+}
+
+//------------------------------------
+// Completed traces
+//
+
+static void histogram_add(uint8_t histogram, uint32_t elapsed) {
+    uint8_t bucket = 0;
+    while (elapsed && bucket < LATENCY_TRACE_HISTOGRAM_BUCKETS - 1) {
+        elapsed >>= 1;
+        bucket++;
+    }
+    if (histograms[histogram][bucket] < UINT16_MAX) {
+        histograms[histogram][bucket]++;
+    }
+}
+
+static void record_trace(const latency_trace_t *trace) {
+    uint8_t  previous = LATENCY_STAGE_COUNT;
+    uint32_t first    = 0;
+    for (uint8_t stage = 0; stage < LATENCY_STAGE_COUNT; stage++) {
+        if (!(trace->stamped & STAGE_BIT(stage))) {
+            continue;
+        }
+        if (previous == LATENCY_STAGE_COUNT) {
+            first = trace->time[stage];
+        } else {
+            histogram_add(stage, TIMER_DIFF_32(trace->time[stage], trace->time[previous]));
+        }
+        previous = stage;
+    }
+    histogram_add(LATENCY_TRACE_TOTAL, TIMER_DIFF_32(trace->time[previous], first));
+
+    completed[completed_head] = *trace;
+    completed_head            = (completed_head + 1) % LATENCY_TRACE_BUFFER_SIZE;
+    if (completed_count < LATENCY_TRACE_BUFFER_SIZE) {
+        completed_count++;
+    }
+}
+
+void latency_trace_complete(void) {
+    for (uint8_t i = 0; i < LATENCY_TRACE_IN_FLIGHT; i++) {
+        latency_trace_t *trace = &in_flight[i];
+        if (trace->stamped & STAGE_BIT(LATENCY_STAGE_RELEASE)) {
+            record_trace(trace);
+            trace->stamped = 0;
+        }
+    }
+}
+
+uint8_t latency_trace_count(void) {
+    return completed_count;
+}
+
+bool latency_trace_get(uint8_t index, latency_trace_t *trace) {
+    if (index >= completed_count) {
+        return false;
+    }
+    *trace = completed[(completed_head + LATENCY_TRACE_BUFFER_SIZE - completed_count + index) % LATENCY_TRACE_BUFFER_SIZE];
+    return true;
+}
+
+const uint16_t *latency_trace_histogram(uint8_t stage) {
+    return histograms[stage > LATENCY_TRACE_TOTAL ? LATENCY_TRACE_TOTAL : stage];
+}
+
+uint16_t latency_trace_dropped(void) {
+    return dropped;
+}
+
+void latency_trace_print(void) {
+#ifdef CONSOLE_ENABLE
+    static const char *const names[LATENCY_STAGE_COUNT + 1] = {"matrix", "debounce", "action", "release", "report", "total"};
+    for (uint8_t stage = LATENCY_STAGE_DEBOUNCE; stage <= LATENCY_TRACE_TOTAL; stage++) {
+        uprintf("%-8s", names[stage]);
+        for (uint8_t bucket = 0; bucket < LATENCY_TRACE_HISTOGRAM_BUCKETS; bucket++) {
+            uprintf(" %u", histograms[stage][bucket]);
+        }
+        uprintf("\n");
+    }
+    uprintf("dropped  %u\n", dropped);
+#endif
+}
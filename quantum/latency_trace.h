@@ -0,0 +1,126 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "keyboard.h"
+#include "matrix.h"
+
+/**
+ * @def The number of key events that can be traced concurrently, i.e. detected on the matrix but not yet delivered
+ *      to the action layer. When full, the oldest event in flight is dropped.
+ */
+#ifndef LATENCY_TRACE_IN_FLIGHT
+#    define LATENCY_TRACE_IN_FLIGHT 8
+#endif
+
+/**
+ * @def The number of completed traces kept for readout. Older traces are overwritten.
+ */
+#ifndef LATENCY_TRACE_BUFFER_SIZE
+#    define LATENCY_TRACE_BUFFER_SIZE 16
+#endif
+
+/**
+ * @def The number of logarithmic histogram buckets per stage. Bucket 0 counts zero-length intervals, bucket N counts
+ *      intervals of [2^(N-1), 2^N) timestamp units, and the last bucket also counts everything longer.
+ */
+#ifndef LATENCY_TRACE_HISTOGRAM_BUCKETS
+#    define LATENCY_TRACE_HISTOGRAM_BUCKETS 16
+#endif
+
+typedef enum latency_stage_t {
+    LATENCY_STAGE_MATRIX,   // the raw matrix scan saw the switch change
+    LATENCY_STAGE_DEBOUNCE, // the change left the debouncer and reached matrix_task()
+    LATENCY_STAGE_ACTION,   // action_exec() received the event
+    LATENCY_STAGE_RELEASE,  // the tapping and combo buffers released the event to process_record()
+    LATENCY_STAGE_REPORT,   // the first keyboard report after processing was handed to the host driver
+    LATENCY_STAGE_COUNT,
+} latency_stage_t;
+
+/**
+ * @def Histogram index for the end-to-end time from the first to the last stamp of each trace.
+ */
+#define LATENCY_TRACE_TOTAL LATENCY_STAGE_COUNT
+
+typedef struct latency_trace_t {
+    keypos_t key;
+    bool     pressed;
+    uint8_t  stamped; // bitmask of (1 << latency_stage_t) stages that were reached
+    uint32_t time[LATENCY_STAGE_COUNT];
+} latency_trace_t;
+
+/**
+ * Discards all traces in flight, completed traces and histograms.
+ */
+void latency_trace_clear(void);
+
+/**
+ * Returns the current timestamp used for tracing. Defaults to `timer_read32()`, boards can override it with a finer
+ * grained counter -- all histograms are expressed in whatever unit this returns.
+ */
+uint32_t latency_trace_timestamp(void);
+
+/**
+ * Stamps the matrix stage for every switch that changed since the previous raw scan.
+ *
+ * @param raw[in] the raw matrix rows for this half
+ * @param first_row[in] the matrix row corresponding to `raw[0]`
+ * @param rows[in] the number of rows in `raw`
+ */
+void latency_trace_raw_matrix(const matrix_row_t *raw, uint8_t first_row, uint8_t rows);
+
+/**
+ * Stamps a pipeline stage for a key event. Events first seen at the debounce or action stage start a new trace.
+ */
+void latency_trace_key(keypos_t key, bool pressed, latency_stage_t stage);
+
+/**
+ * Marks a key event as buffered again after it reached process_record(), e.g. by the combo engine.
+ */
+void latency_trace_hold(keypos_t key, bool pressed);
+
+/**
+ * Stamps the report stage for every processed event that has not seen a report yet.
+ */
+void latency_trace_report(void);
+
+/**
+ * Completes every processed event, recording it into the ring buffer and histograms. Called at the end of
+ * action_exec().
+ */
+void latency_trace_complete(void);
+
+/**
+ * @return the number of completed traces available for readout
+ */
+uint8_t latency_trace_count(void);
+
+/**
+ * Reads a completed trace, oldest first.
+ *
+ * @param index[in] the trace to read, less than `latency_trace_count()`
+ * @param trace[out] the trace
+ * @return true if the trace exists
+ */
+bool latency_trace_get(uint8_t index, latency_trace_t *trace);
+
+/**
+ * Returns the histogram of a stage, counting the time since the previous stamped stage. `LATENCY_TRACE_TOTAL`
+ * counts the end-to-end time. Suitable for copying into a raw HID response.
+ *
+ * @return an array of `LATENCY_TRACE_HISTOGRAM_BUCKETS` saturating counters
+ */
+const uint16_t *latency_trace_histogram(uint8_t stage);
+
+/**
+ * @return the number of events dropped before reaching the action layer
+ */
+uint16_t latency_trace_dropped(void);
+
+/**
+ * Prints the histograms to the console.
+ */
+void latency_trace_print(void);
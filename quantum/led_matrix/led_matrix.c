@@ -78,7 +78,18 @@ static led_task_states led_task_state    = SYNCING;
 // double buffers
 static uint32_t led_timer_buffer;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-static last_hit_t last_hit_buffer;
+// Ring buffer of recent hits, oldest first. Hits are stamped with the time they happened, so ticks are derived when
+// the frame snapshot is taken instead of every entry being aged on every task run.
+static struct {
+    uint8_t  head;
+    uint8_t  count;
+    uint8_t  index[LED_HITS_TO_REMEMBER];
+    uint32_t time[LED_HITS_TO_REMEMBER];
+} last_hit_buffer;
+
+static inline uint8_t last_hit_next(uint8_t pos) {
+    return ++pos == LED_HITS_TO_REMEMBER ? 0 : pos;
+}
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
 // split led matrix
@@ -186,21 +197,18 @@ void led_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         led_count = led_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
+    uint32_t now = sync_timer_read32();
     for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
-        last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
-        last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
-        last_hit_buffer.index[index] = led[i];
-        last_hit_buffer.tick[index]  = 0;
-        last_hit_buffer.count++;
+        uint8_t slot = last_hit_buffer.head + last_hit_buffer.count;
+        if (slot >= LED_HITS_TO_REMEMBER) slot -= LED_HITS_TO_REMEMBER;
+        if (last_hit_buffer.count == LED_HITS_TO_REMEMBER) {
+            // Full: overwrite the oldest hit
+            last_hit_buffer.head = last_hit_next(last_hit_buffer.head);
+        } else {
+            last_hit_buffer.count++;
+        }
+        last_hit_buffer.index[slot] = led[i];
+        last_hit_buffer.time[slot]  = now;
     }
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
@@ -221,23 +229,36 @@ static bool led_matrix_none(effect_params_t *params) {
 }
 
 static void led_task_timers(void) {
-#if defined(LED_MATRIX_KEYREACTIVE_ENABLED)
-    uint32_t deltaTime = sync_timer_elapsed32(led_timer_buffer);
-#endif // defined(LED_MATRIX_KEYREACTIVE_ENABLED)
     led_timer_buffer = sync_timer_read32();
+}
 
-    // Update double buffer last hit timers
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-    uint8_t count = last_hit_buffer.count;
-    for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
+static void led_task_last_hits(void) {
+    uint8_t pos   = last_hit_buffer.head;
+    uint8_t count = 0;
+    for (uint8_t i = last_hit_buffer.count; i > 0; i--) {
+        uint32_t age = TIMER_DIFF_32(led_timer_buffer, last_hit_buffer.time[pos]);
+        if ((int32_t)age < 0) {
+            age = 0;
+        } else if (age >= UINT16_MAX) {
+            // Only the oldest hits can have expired, so dropping them from the front keeps the ring contiguous
+            last_hit_buffer.head = last_hit_next(pos);
             last_hit_buffer.count--;
+            pos = last_hit_buffer.head;
             continue;
         }
-        last_hit_buffer.tick[i] += deltaTime;
+
+        uint8_t led                     = last_hit_buffer.index[pos];
+        g_last_hit_tracker.x[count]     = g_led_config.point[led].x;
+        g_last_hit_tracker.y[count]     = g_led_config.point[led].y;
+        g_last_hit_tracker.index[count] = led;
+        g_last_hit_tracker.tick[count]  = age;
+        count++;
+        pos = last_hit_next(pos);
     }
-#endif // LED_MATRIX_KEYREACTIVE_ENABLED
+    g_last_hit_tracker.count = count;
 }
+#endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
 static void led_task_sync(void) {
     eeconfig_flush_led_matrix(false);
@@ -252,7 +273,7 @@ static void led_task_start(void) {
     // update double buffers
     g_led_timer = led_timer_buffer;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker = last_hit_buffer;
+    led_task_last_hits();
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
     // next task
@@ -426,10 +447,8 @@ void led_matrix_init(void) {
         g_last_hit_tracker.tick[i] = UINT16_MAX;
     }
 
+    last_hit_buffer.head  = 0;
     last_hit_buffer.count = 0;
-    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
-        last_hit_buffer.tick[i] = UINT16_MAX;
-    }
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
     eeconfig_init_led_matrix();
@@ -73,5 +73,11 @@ int main(void) {
 #endif // DEFERRED_EXEC_ENABLE
 
         housekeeping_task();
+
+#ifdef IDLE_SCHEDULER_ENABLE
+        // Sleep until the next wakeup, if nothing needs the loop to keep running
+        void idle_scheduler_task(void);
+        idle_scheduler_task();
+#endif // IDLE_SCHEDULER_ENABLE
     }
 }
@@ -21,6 +21,14 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "atomic_util.h"
+#ifdef MATRIX_SETTLE_CALIBRATION
+#    include "eeconfig.h"
+#    include "timer.h"
+#    include "wait.h"
+#endif
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -104,6 +112,228 @@ static inline uint8_t readMatrixPin(pin_t pin) {
     }
 }
 
+// The lines selected one at a time by the scan, and the lines read for each of them
+#if !defined(DIRECT_PINS) && defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
+#    if (DIODE_DIRECTION == COL2ROW)
+#        define MATRIX_OUTPUT_PINS ROWS_PER_HAND
+#        define matrix_output_pins row_pins
+#        define MATRIX_INPUT_PINS MATRIX_COLS
+#        define matrix_input_pins col_pins
+#    elif (DIODE_DIRECTION == ROW2COL)
+#        define MATRIX_OUTPUT_PINS MATRIX_COLS
+#        define matrix_output_pins col_pins
+#        define MATRIX_INPUT_PINS ROWS_PER_HAND
+#        define matrix_input_pins row_pins
+#    endif
+#endif
+
+// Read every input pin on a GPIO port at once, where the platform supports it
+#if defined(gpio_read_port) && !defined(MATRIX_DISABLE_PORT_READS) && defined(MATRIX_INPUT_PINS)
+#    if (MATRIX_INPUT_PINS <= 8)
+typedef uint8_t matrix_input_t;
+#    elif (MATRIX_INPUT_PINS <= 16)
+typedef uint16_t matrix_input_t;
+#    elif (MATRIX_INPUT_PINS <= 32)
+typedef uint32_t matrix_input_t;
+#    endif
+#    if (MATRIX_INPUT_PINS <= 32)
+#        define MATRIX_PORT_READS
+#    endif
+#endif
+
+#ifdef MATRIX_PORT_READS
+// A run of input pins on consecutive pads of the same port, copied into the matrix with one shift and mask
+typedef struct {
+    uint8_t          port;  // index into input_ports
+    uint8_t          pad;   // pad of the first pin
+    uint8_t          index; // column, or row, of the first pin
+    gpio_port_data_t mask;
+} matrix_input_run_t;
+
+static pin_t              input_ports[MATRIX_INPUT_PINS]; // one pin on each port used by the inputs
+static uint8_t            input_port_count;
+static matrix_input_run_t input_runs[MATRIX_INPUT_PINS];
+static uint8_t            input_run_count;
+
+// Group the input pins by port, after any right hand pins have been applied
+static void init_input_ports(void) {
+    uint8_t width = 0;
+
+    input_port_count = 0;
+    input_run_count  = 0;
+    for (uint8_t index = 0; index < MATRIX_INPUT_PINS; index++) {
+        pin_t pin = matrix_input_pins[index];
+        if (pin == NO_PIN) {
+            continue;
+        }
+
+        uint8_t port = 0;
+        while (port < input_port_count && gpio_pin_port(input_ports[port]) != gpio_pin_port(pin)) {
+            port++;
+        }
+        if (port == input_port_count) {
+            input_ports[input_port_count++] = pin;
+        }
+
+        // Extend the previous run if this pin follows on from it
+        if (input_run_count > 0) {
+            matrix_input_run_t *run = &input_runs[input_run_count - 1];
+            if (run->port == port && run->index + width == index && run->pad + width == gpio_pin_pad(pin)) {
+                run->mask = (run->mask << 1) | 1;
+                width++;
+                continue;
+            }
+        }
+
+        input_runs[input_run_count++] = (matrix_input_run_t){.port = port, .pad = gpio_pin_pad(pin), .index = index, .mask = 1};
+        width                         = 1;
+    }
+}
+
+// Read each input port once, returning a bit for every input that is pressed
+static matrix_input_t read_input_ports(void) {
+    gpio_port_data_t port_values[MATRIX_INPUT_PINS];
+    for (uint8_t port = 0; port < input_port_count; port++) {
+#    if (MATRIX_INPUT_PRESSED_STATE == 0)
+        port_values[port] = ~gpio_read_port(input_ports[port]);
+#    else
+        port_values[port] = gpio_read_port(input_ports[port]);
+#    endif
+    }
+
+    matrix_input_t pressed = 0;
+    for (uint8_t i = 0; i < input_run_count; i++) {
+        const matrix_input_run_t *run = &input_runs[i];
+        pressed |= (matrix_input_t)((port_values[run->port] >> run->pad) & run->mask) << run->index;
+    }
+    return pressed;
+}
+#endif
+
+#ifdef MATRIX_SETTLE_CALIBRATION
+#    ifndef MATRIX_INPUT_PINS
+#        error MATRIX_SETTLE_CALIBRATION requires a COL2ROW or ROW2COL matrix with MATRIX_ROW_PINS and MATRIX_COL_PINS
+#    endif
+#    ifndef MATRIX_IO_DELAY
+#        define MATRIX_IO_DELAY 30
+#    endif
+#    ifndef MATRIX_SETTLE_MARGIN
+#        define MATRIX_SETTLE_MARGIN 2
+#    endif
+#    if (MATRIX_IO_DELAY >= MATRIX_SETTLE_UNCALIBRATED)
+#        error MATRIX_SETTLE_CALIBRATION requires MATRIX_IO_DELAY to be less than 255
+#    endif
+#    ifndef MATRIX_SETTLE_RECHECK_INTERVAL
+#        define MATRIX_SETTLE_RECHECK_INTERVAL 10000
+#    endif
+// Free-running counter used to time the pull-ups, as counting wait_us(1) steps adds the loop overhead to every step
+#    if !defined(MATRIX_SETTLE_TIMESTAMP) && defined(PROTOCOL_CHIBIOS) && (PORT_SUPPORTS_RT == TRUE)
+#        define MATRIX_SETTLE_TIMESTAMP() chSysGetRealtimeCounterX()
+#        define MATRIX_SETTLE_TICKS_PER_US (REALTIME_COUNTER_CLOCK / 1000000)
+#    endif
+
+static uint8_t  settle_delays[MATRIX_SETTLE_LINES];
+static uint8_t  settle_recheck_line;
+static uint32_t settle_recheck_timer;
+
+// Time how long the pull-up takes to bring a line back high after it was driven low, in microseconds
+static uint8_t measure_settle_time(pin_t pin) {
+    uint8_t time = 0;
+    if (pin != NO_PIN) {
+        gpio_atomic_set_pin_output_low(pin);
+#    ifdef MATRIX_SETTLE_TIMESTAMP
+        uint32_t start   = MATRIX_SETTLE_TIMESTAMP();
+        uint32_t elapsed = 0;
+        gpio_atomic_set_pin_input_high(pin);
+        while (!gpio_read_pin(pin) && elapsed < MATRIX_IO_DELAY * MATRIX_SETTLE_TICKS_PER_US) {
+            elapsed = MATRIX_SETTLE_TIMESTAMP() - start;
+        }
+        time = MIN((elapsed + MATRIX_SETTLE_TICKS_PER_US - 1) / MATRIX_SETTLE_TICKS_PER_US, MATRIX_IO_DELAY);
+#    else
+        // Without a counter, each step takes at least a microsecond, so this overestimates
+        gpio_atomic_set_pin_input_high(pin);
+        while (!gpio_read_pin(pin) && time < MATRIX_IO_DELAY) {
+            wait_us(1);
+            time++;
+        }
+#    endif
+    }
+    return time;
+}
+
+static uint8_t measure_inputs_settle_time(void) {
+    uint8_t time = 0;
+    for (uint8_t i = 0; i < MATRIX_INPUT_PINS; i++) {
+        time = MAX(time, measure_settle_time(matrix_input_pins[i]));
+    }
+    return time;
+}
+
+// After a line is unselected, the inputs that a pressed key pulled low must be back high. Unless it is
+// driven high, the line itself must also be back high before it stops pulling down on the inputs.
+static uint8_t measure_settle_delay(uint8_t line, uint8_t inputs_settle_time) {
+    uint8_t time = inputs_settle_time;
+#    ifndef MATRIX_UNSELECT_DRIVE_HIGH
+    time = MAX(time, measure_settle_time(matrix_output_pins[line]));
+#    endif
+    return MIN(time + MATRIX_SETTLE_MARGIN, MATRIX_IO_DELAY);
+}
+
+void matrix_settle_calibrate(void) {
+    uint8_t inputs_settle_time = measure_inputs_settle_time();
+    for (uint8_t line = 0; line < MATRIX_SETTLE_LINES; line++) {
+        settle_delays[line] = measure_settle_delay(line, inputs_settle_time);
+    }
+    // Before eeconfig has been initialised, the calibration only lasts until the next boot
+    if (eeconfig_is_enabled()) {
+        eeconfig_update_matrix_settle(settle_delays);
+    }
+}
+
+uint8_t matrix_settle_get_delay(uint8_t line) {
+    return settle_delays[line];
+}
+
+static void matrix_settle_init(void) {
+    bool valid = eeconfig_is_enabled();
+    if (valid) {
+        eeconfig_read_matrix_settle(settle_delays);
+        // Every calibrated delay includes the margin, so anything below it was not written by a calibration
+        for (uint8_t line = 0; line < MATRIX_SETTLE_LINES; line++) {
+            valid &= settle_delays[line] >= MIN(MATRIX_SETTLE_MARGIN, MATRIX_IO_DELAY) && settle_delays[line] <= MATRIX_IO_DELAY;
+        }
+    }
+    if (!valid) {
+        matrix_settle_calibrate();
+    }
+    settle_recheck_timer = timer_read32();
+}
+
+// Periodically measure one line again, in case it has become slower since it was calibrated
+static void matrix_settle_task(void) {
+    if (timer_elapsed32(settle_recheck_timer) < MATRIX_SETTLE_RECHECK_INTERVAL) {
+        return;
+    }
+    settle_recheck_timer = timer_read32();
+
+    uint8_t delay = measure_settle_delay(settle_recheck_line, measure_inputs_settle_time());
+    if (delay > settle_delays[settle_recheck_line]) {
+        settle_delays[settle_recheck_line] = delay;
+        if (eeconfig_is_enabled()) {
+            eeconfig_update_matrix_settle(settle_delays);
+        }
+    }
+    settle_recheck_line = (settle_recheck_line + 1) % MATRIX_SETTLE_LINES;
+}
+
+// Nothing was pulled low on a line without any key pressed, so there is nothing to wait for
+static inline void matrix_settle_delay(uint8_t line, bool key_pressed) {
+    if (key_pressed) {
+        wait_us(settle_delays[line]);
+    }
+}
+#endif
+
 // matrix code
 
 #ifdef DIRECT_PINS
@@ -181,6 +411,9 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_PORT_READS
+    current_row_value = read_input_ports();
+#            else
     // For each col...
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
@@ -189,10 +422,15 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
         // Populate the matrix row with the state of the col pin
         current_row_value |= pin_state ? 0 : row_shifter;
     }
+#            endif
 
     // Unselect row
     unselect_row(current_row);
+#            ifdef MATRIX_SETTLE_CALIBRATION
+    matrix_settle_delay(current_row, current_row_value != 0);
+#            else
     matrix_output_unselect_delay(current_row, current_row_value != 0); // wait for all Col signals to go HIGH
+#            endif
 
     // Update the matrix
     current_matrix[current_row] = current_row_value;
@@ -244,10 +482,18 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_PORT_READS
+    matrix_input_t pressed = read_input_ports();
+#            endif
+
     // For each row...
     for (uint8_t row_index = 0; row_index < ROWS_PER_HAND; row_index++) {
         // Check row pin state
+#            ifdef MATRIX_PORT_READS
+        if (pressed & ((matrix_input_t)1 << row_index)) {
+#            else
         if (readMatrixPin(row_pins[row_index]) == 0) {
+#            endif
             // Pin LO, set col bit
             current_matrix[row_index] |= row_shifter;
             key_pressed = true;
@@ -259,7 +505,11 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 
     // Unselect col
     unselect_col(current_col);
+#            ifdef MATRIX_SETTLE_CALIBRATION
+    matrix_settle_delay(current_col, key_pressed);
+#            else
     matrix_output_unselect_delay(current_col, key_pressed); // wait for all Row signals to go HIGH
+#            endif
 }
 
 #        else
@@ -302,6 +552,12 @@ void matrix_init(void) {
 
     // initialize key pins
     matrix_init_pins();
+#ifdef MATRIX_PORT_READS
+    init_input_ports();
+#endif
+#ifdef MATRIX_SETTLE_CALIBRATION
+    matrix_settle_init();
+#endif
 
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
@@ -323,6 +579,10 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 uint8_t matrix_scan(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
+#ifdef MATRIX_SETTLE_CALIBRATION
+    matrix_settle_task();
+#endif
+
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
     // Set row, read cols
     for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
@@ -339,6 +599,14 @@ uint8_t matrix_scan(void) {
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
 
+#ifdef LATENCY_TRACE_ENABLE
+#    ifdef SPLIT_KEYBOARD
+    latency_trace_raw_matrix(raw_matrix, thisHand, ROWS_PER_HAND);
+#    else
+    latency_trace_raw_matrix(raw_matrix, 0, ROWS_PER_HAND);
+#    endif
+#endif
+
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
 #else
@@ -37,6 +37,19 @@ typedef uint32_t matrix_row_t;
 
 #define MATRIX_ROW_SHIFTER ((matrix_row_t)1)
 
+#ifdef MATRIX_SETTLE_CALIBRATION
+/* number of lines driven by the matrix scan, each with its own settle delay */
+#    if (DIODE_DIRECTION == ROW2COL)
+#        define MATRIX_SETTLE_LINES MATRIX_COLS
+#    elif defined(SPLIT_KEYBOARD)
+#        define MATRIX_SETTLE_LINES (MATRIX_ROWS / 2)
+#    else
+#        define MATRIX_SETTLE_LINES MATRIX_ROWS
+#    endif
+/* stored in place of a delay before the line has been calibrated */
+#    define MATRIX_SETTLE_UNCALIBRATED 0xFF
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -65,6 +78,13 @@ void matrix_output_unselect_delay(uint8_t line, bool key_pressed);
 /* only for backwards compatibility. delay between changing matrix pin state and reading values */
 void matrix_io_delay(void);
 
+#ifdef MATRIX_SETTLE_CALIBRATION
+/* measure the settle delay of every matrix line, and store it */
+void matrix_settle_calibrate(void);
+/* delay in microseconds waited after unselecting a line with a key pressed */
+uint8_t matrix_settle_get_delay(uint8_t line);
+#endif
+
 /* power control */
 void matrix_power_up(void);
 void matrix_power_down(void);
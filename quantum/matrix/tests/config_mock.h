@@ -0,0 +1,29 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 16
+
+#define DIODE_DIRECTION COL2ROW
+
+// Columns spread over three ports, with runs, reversed pins and an unused column
+#define MATRIX_ROW_PINS \
+    { MOCK_PIN(3, 0), MOCK_PIN(3, 1), MOCK_PIN(3, 2), MOCK_PIN(3, 3) }
+#define MATRIX_COL_PINS \
+    { MOCK_PIN(1, 0), MOCK_PIN(1, 1), MOCK_PIN(1, 2), MOCK_PIN(1, 3), MOCK_PIN(2, 7), MOCK_PIN(2, 6), MOCK_PIN(0, 4), MOCK_PIN(0, 5), MOCK_PIN(0, 6), NO_PIN, MOCK_PIN(1, 8), MOCK_PIN(1, 9), MOCK_PIN(2, 0), MOCK_PIN(0, 15), MOCK_PIN(1, 4), MOCK_PIN(1, 5) }
+
+#define MOCK_INPUT_PORTS 3
+#define MOCK_INPUT_PINS 15
+#define MOCK_OUTPUT_PINS 4
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mock.h"
+
+#ifdef __cplusplus
+};
+#endif
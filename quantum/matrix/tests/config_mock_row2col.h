@@ -0,0 +1,29 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 6
+#define MATRIX_COLS 8
+
+#define DIODE_DIRECTION ROW2COL
+
+// Rows spread over two ports, with an unused row
+#define MATRIX_ROW_PINS \
+    { MOCK_PIN(0, 2), MOCK_PIN(0, 3), MOCK_PIN(2, 9), NO_PIN, MOCK_PIN(0, 1), MOCK_PIN(2, 10) }
+#define MATRIX_COL_PINS \
+    { MOCK_PIN(1, 0), MOCK_PIN(1, 1), MOCK_PIN(1, 2), MOCK_PIN(1, 3), MOCK_PIN(1, 4), MOCK_PIN(1, 5), MOCK_PIN(1, 6), MOCK_PIN(1, 7) }
+
+#define MOCK_INPUT_PORTS 2
+#define MOCK_INPUT_PINS 5
+#define MOCK_OUTPUT_PINS 8
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mock.h"
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,120 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+static const pin_t settle_row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t settle_col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+class MatrixSettleTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_reset();
+        set_time(0);
+        mock_eeconfig_enabled       = true;
+        mock_eeconfig_settle_writes = 0;
+        memset(mock_eeconfig_settle, MATRIX_SETTLE_UNCALIBRATED, MATRIX_SETTLE_LINES);
+
+        // Rows settle after 3, 10, 0 and 50 reads, and the slowest column after 4
+        mock_settle_reads[settle_row_pins[0]] = 3;
+        mock_settle_reads[settle_row_pins[1]] = 10;
+        mock_settle_reads[settle_row_pins[3]] = 50;
+        mock_settle_reads[settle_col_pins[2]] = 4;
+        mock_settle_reads[settle_col_pins[5]] = 1;
+    }
+
+    void expect_delays(std::initializer_list<uint8_t> delays) {
+        uint8_t line = 0;
+        for (uint8_t delay : delays) {
+            EXPECT_EQ(matrix_settle_get_delay(line), delay) << "Line " << (int)line << " has the wrong delay";
+            line++;
+        }
+    }
+};
+
+TEST_F(MatrixSettleTest, CalibratesWhenUncalibrated) {
+    matrix_init();
+    // The slower of the row and the slowest column, plus the margin, never more than MATRIX_IO_DELAY
+    expect_delays({6, 12, 6, MATRIX_IO_DELAY});
+    EXPECT_EQ(mock_eeconfig_settle_writes, 1);
+
+    const uint8_t expected[MATRIX_SETTLE_LINES] = {6, 12, 6, MATRIX_IO_DELAY};
+    EXPECT_EQ(memcmp(mock_eeconfig_settle, expected, MATRIX_SETTLE_LINES), 0) << "Calibration was not stored";
+}
+
+TEST_F(MatrixSettleTest, UsesStoredDelays) {
+    const uint8_t stored[MATRIX_SETTLE_LINES] = {2, 3, 4, 5};
+    memcpy(mock_eeconfig_settle, stored, MATRIX_SETTLE_LINES);
+    matrix_init();
+    expect_delays({2, 3, 4, 5});
+    EXPECT_EQ(mock_eeconfig_settle_writes, 0);
+}
+
+TEST_F(MatrixSettleTest, CalibratesWhenStoredDelayInvalid) {
+    const uint8_t stored[MATRIX_SETTLE_LINES] = {2, 3, MATRIX_IO_DELAY + 1, 5};
+    memcpy(mock_eeconfig_settle, stored, MATRIX_SETTLE_LINES);
+    matrix_init();
+    expect_delays({6, 12, 6, MATRIX_IO_DELAY});
+}
+
+TEST_F(MatrixSettleTest, CalibratesWhenStoredDelayBelowMargin) {
+    // Shorter than the default margin of 2, e.g. EEPROM contents left behind by an older layout
+    const uint8_t stored[MATRIX_SETTLE_LINES] = {2, 3, 1, 5};
+    memcpy(mock_eeconfig_settle, stored, MATRIX_SETTLE_LINES);
+    matrix_init();
+    expect_delays({6, 12, 6, MATRIX_IO_DELAY});
+    EXPECT_EQ(mock_eeconfig_settle_writes, 1);
+}
+
+TEST_F(MatrixSettleTest, CalibratesWhenStoredDelaysCleared) {
+    memset(mock_eeconfig_settle, 0, MATRIX_SETTLE_LINES);
+    matrix_init();
+    expect_delays({6, 12, 6, MATRIX_IO_DELAY});
+    EXPECT_EQ(mock_eeconfig_settle_writes, 1);
+}
+
+TEST_F(MatrixSettleTest, NotStoredBeforeEeconfigInit) {
+    mock_eeconfig_enabled = false;
+    memset(mock_eeconfig_settle, 0, MATRIX_SETTLE_LINES);
+    matrix_init();
+    expect_delays({6, 12, 6, MATRIX_IO_DELAY});
+    EXPECT_EQ(mock_eeconfig_settle_writes, 0);
+}
+
+TEST_F(MatrixSettleTest, OnDemandCalibration) {
+    matrix_init();
+    mock_settle_reads[settle_row_pins[1]] = 0;
+    mock_settle_reads[settle_row_pins[3]] = 0;
+    matrix_settle_calibrate();
+    expect_delays({6, 6, 6, 6});
+    EXPECT_EQ(mock_eeconfig_settle_writes, 2);
+}
+
+TEST_F(MatrixSettleTest, RecheckOnlyRaisesDelays) {
+    matrix_init();
+    mock_settle_reads[settle_row_pins[0]] = 0;
+    mock_settle_reads[settle_row_pins[2]] = 20;
+
+    // Nothing is measured before the interval has passed
+    advance_time(MATRIX_SETTLE_RECHECK_INTERVAL - 1);
+    matrix_scan();
+    expect_delays({6, 12, 6, MATRIX_IO_DELAY});
+
+    // Then one line is measured each interval
+    for (uint8_t line = 0; line < MATRIX_SETTLE_LINES; line++) {
+        advance_time(MATRIX_SETTLE_RECHECK_INTERVAL);
+        matrix_scan();
+        matrix_scan();
+    }
+    expect_delays({6, 12, 22, MATRIX_IO_DELAY});
+    EXPECT_EQ(mock_eeconfig_settle_writes, 2);
+    EXPECT_EQ(mock_eeconfig_settle[2], 22);
+}
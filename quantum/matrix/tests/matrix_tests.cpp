@@ -0,0 +1,83 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+
+extern matrix_row_t matrix[MATRIX_ROWS];
+}
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+class MatrixTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_reset();
+        matrix_init();
+    }
+
+    // The matrix expected from the pressed keys, leaving out keys on unused pins
+    void expected_matrix(matrix_row_t expected[]) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            expected[row] = 0;
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                if (mock_keys[row][col] && row_pins[row] != NO_PIN && col_pins[col] != NO_PIN) {
+                    expected[row] |= MATRIX_ROW_SHIFTER << col;
+                }
+            }
+        }
+    }
+
+    void scan_and_check(void) {
+        matrix_row_t expected[MATRIX_ROWS];
+        expected_matrix(expected);
+        matrix_scan();
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            EXPECT_EQ(matrix[row], expected[row]) << "Row " << (int)row << " does not match the pressed keys";
+        }
+    }
+};
+
+TEST_F(MatrixTest, NoKeysPressed) {
+    scan_and_check();
+}
+
+TEST_F(MatrixTest, EachKeyAlone) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            mock_keys[row][col] = true;
+            scan_and_check();
+            mock_keys[row][col] = false;
+        }
+    }
+    scan_and_check();
+}
+
+TEST_F(MatrixTest, RandomKeys) {
+    uint32_t seed = 0x2545F491;
+    for (int i = 0; i < 1000; i++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                seed                = seed * 1103515245 + 12345;
+                mock_keys[row][col] = ((seed >> 16) % 4) == 0;
+            }
+        }
+        scan_and_check();
+    }
+}
+
+TEST_F(MatrixTest, ReadsPerScan) {
+    mock_pin_reads  = 0;
+    mock_port_reads = 0;
+    matrix_scan();
+#ifdef MATRIX_DISABLE_PORT_READS
+    EXPECT_EQ(mock_port_reads, 0);
+    EXPECT_EQ(mock_pin_reads, MOCK_OUTPUT_PINS * MOCK_INPUT_PINS) << "Every input pin should be read once for each output";
+#else
+    EXPECT_EQ(mock_pin_reads, 0);
+    EXPECT_EQ(mock_port_reads, MOCK_OUTPUT_PINS * MOCK_INPUT_PORTS) << "Every input port should be read once for each output";
+#endif
+}
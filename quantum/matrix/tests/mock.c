@@ -0,0 +1,121 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "matrix.h"
+#ifdef MATRIX_SETTLE_CALIBRATION
+#    include "eeconfig.h"
+#endif
+
+bool     mock_keys[MATRIX_ROWS][MATRIX_COLS];
+uint32_t mock_pin_reads;
+uint32_t mock_port_reads;
+uint8_t  mock_settle_reads[MOCK_PORTS * 16];
+
+static const pin_t mock_row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t mock_col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+static bool    pin_is_output[MOCK_PORTS * 16];
+static bool    pin_level[MOCK_PORTS * 16];
+static uint8_t pin_settling[MOCK_PORTS * 16];
+
+void mock_reset(void) {
+    memset(mock_keys, 0, sizeof(mock_keys));
+    memset(pin_is_output, 0, sizeof(pin_is_output));
+    memset(pin_level, 0, sizeof(pin_level));
+    memset(pin_settling, 0, sizeof(pin_settling));
+    memset(mock_settle_reads, 0, sizeof(mock_settle_reads));
+    mock_pin_reads  = 0;
+    mock_port_reads = 0;
+}
+
+void mock_set_pin_input_high(pin_t pin) {
+    if (pin_is_output[pin] && !pin_level[pin]) {
+        pin_settling[pin] = mock_settle_reads[pin];
+    }
+    pin_is_output[pin] = false;
+}
+
+void mock_set_pin_output(pin_t pin) {
+    pin_is_output[pin] = true;
+}
+
+void mock_write_pin(pin_t pin, bool level) {
+    pin_level[pin] = level;
+}
+
+static bool driven_low(pin_t pin) {
+    return pin != NO_PIN && pin_is_output[pin] && !pin_level[pin];
+}
+
+// An input is pulled up, unless a pressed key connects it to an output driven low
+static bool pin_state(pin_t pin) {
+    if (pin_is_output[pin]) {
+        return pin_level[pin];
+    }
+    if (pin_settling[pin] > 0) {
+        pin_settling[pin]--;
+        return false;
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (!mock_keys[row][col]) {
+                continue;
+            }
+#if (DIODE_DIRECTION == COL2ROW)
+            if (mock_col_pins[col] == pin && driven_low(mock_row_pins[row])) {
+                return false;
+            }
+#else
+            if (mock_row_pins[row] == pin && driven_low(mock_col_pins[col])) {
+                return false;
+            }
+#endif
+        }
+    }
+    return true;
+}
+
+bool mock_read_pin(pin_t pin) {
+    mock_pin_reads++;
+    return pin_state(pin);
+}
+
+gpio_port_data_t mock_read_port(pin_t pin) {
+    gpio_port_data_t value = 0;
+    for (uint8_t pad = 0; pad < 16; pad++) {
+        value |= (gpio_port_data_t)pin_state(MOCK_PIN(gpio_pin_port(pin), pad)) << pad;
+    }
+    mock_port_reads++;
+    return value;
+}
+
+void matrix_output_select_delay(void) {}
+
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
+
+void matrix_init_kb(void) {}
+
+void matrix_scan_kb(void) {}
+
+matrix_row_t raw_matrix[MATRIX_ROWS];
+matrix_row_t matrix[MATRIX_ROWS];
+
+#ifdef MATRIX_SETTLE_CALIBRATION
+bool    mock_eeconfig_enabled;
+uint8_t mock_eeconfig_settle[MATRIX_SETTLE_LINES];
+uint8_t mock_eeconfig_settle_writes;
+
+bool eeconfig_is_enabled(void) {
+    return mock_eeconfig_enabled;
+}
+
+void eeconfig_read_matrix_settle(uint8_t *settle) {
+    memcpy(settle, mock_eeconfig_settle, MATRIX_SETTLE_LINES);
+}
+
+void eeconfig_update_matrix_settle(const uint8_t *settle) {
+    memcpy(mock_eeconfig_settle, settle, MATRIX_SETTLE_LINES);
+    mock_eeconfig_settle_writes++;
+}
+#endif
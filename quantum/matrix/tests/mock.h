@@ -0,0 +1,50 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Pins are numbered as on AVR, with the port in the upper nibble and the pad in the lower nibble
+typedef uint8_t  pin_t;
+typedef uint16_t gpio_port_data_t;
+
+#define MOCK_PORTS 4
+#define MOCK_PIN(port, pad) (((port) << 4) | (pad))
+
+#define gpio_set_pin_input_high(pin) mock_set_pin_input_high(pin)
+#define gpio_set_pin_output(pin) mock_set_pin_output(pin)
+#define gpio_write_pin_high(pin) mock_write_pin(pin, true)
+#define gpio_write_pin_low(pin) mock_write_pin(pin, false)
+#define gpio_read_pin(pin) mock_read_pin(pin)
+
+#define gpio_pin_port(pin) ((pin) >> 4)
+#define gpio_pin_pad(pin) ((pin)&0xF)
+#define gpio_read_port(pin) mock_read_port(pin)
+
+extern bool     mock_keys[MATRIX_ROWS][MATRIX_COLS];
+extern uint32_t mock_pin_reads;
+extern uint32_t mock_port_reads;
+
+// Number of reads for which a line still reads low after it stops being driven low
+extern uint8_t mock_settle_reads[MOCK_PORTS * 16];
+
+#ifdef MATRIX_SETTLE_CALIBRATION
+// Each pin read takes one microsecond
+#    define MATRIX_SETTLE_TIMESTAMP() mock_pin_reads
+#    define MATRIX_SETTLE_TICKS_PER_US 1
+
+extern bool    mock_eeconfig_enabled;
+extern uint8_t mock_eeconfig_settle[];
+extern uint8_t mock_eeconfig_settle_writes;
+#endif
+
+void mock_reset(void);
+
+void mock_set_pin_input_high(pin_t pin);
+void mock_set_pin_output(pin_t pin);
+void mock_write_pin(pin_t pin, bool level);
+
+bool             mock_read_pin(pin_t pin);
+gpio_port_data_t mock_read_port(pin_t pin);
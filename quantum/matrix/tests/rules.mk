@@ -0,0 +1,47 @@
+matrix_col2row_DEFS := -DIGNORE_ATOMIC_BLOCK
+matrix_col2row_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock.h
+
+matrix_col2row_SRC := \
+	$(QUANTUM_PATH)/matrix.c \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/matrix/tests/mock.c \
+	$(QUANTUM_PATH)/matrix/tests/matrix_tests.cpp
+
+matrix_col2row_pin_reads_DEFS := -DIGNORE_ATOMIC_BLOCK -DMATRIX_DISABLE_PORT_READS
+matrix_col2row_pin_reads_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock.h
+
+matrix_col2row_pin_reads_SRC := \
+	$(QUANTUM_PATH)/matrix.c \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/matrix/tests/mock.c \
+	$(QUANTUM_PATH)/matrix/tests/matrix_tests.cpp
+
+matrix_row2col_DEFS := -DIGNORE_ATOMIC_BLOCK
+matrix_row2col_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock_row2col.h
+
+matrix_row2col_SRC := \
+	$(QUANTUM_PATH)/matrix.c \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/matrix/tests/mock.c \
+	$(QUANTUM_PATH)/matrix/tests/matrix_tests.cpp
+
+matrix_row2col_pin_reads_DEFS := -DIGNORE_ATOMIC_BLOCK -DMATRIX_DISABLE_PORT_READS
+matrix_row2col_pin_reads_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock_row2col.h
+
+matrix_row2col_pin_reads_SRC := \
+	$(QUANTUM_PATH)/matrix.c \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/matrix/tests/mock.c \
+	$(QUANTUM_PATH)/matrix/tests/matrix_tests.cpp
+
+matrix_settle_DEFS := -DIGNORE_ATOMIC_BLOCK -DEEPROM_TEST_HARNESS -DMATRIX_SETTLE_CALIBRATION -DMATRIX_IO_DELAY=30 -DMATRIX_SETTLE_RECHECK_INTERVAL=10000
+matrix_settle_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock.h
+
+matrix_settle_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/matrix.c \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/matrix/tests/mock.c \
+	$(QUANTUM_PATH)/matrix/tests/matrix_tests.cpp \
+	$(QUANTUM_PATH)/matrix/tests/matrix_settle_tests.cpp
@@ -0,0 +1,6 @@
+TEST_LIST += \
+	matrix_col2row \
+	matrix_col2row_pin_reads \
+	matrix_row2col \
+	matrix_row2col_pin_reads \
+	matrix_settle
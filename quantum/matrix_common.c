@@ -3,6 +3,9 @@
 #include "wait.h"
 #include "print.h"
 #include "debug.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -168,6 +171,14 @@ __attribute__((weak)) void matrix_init(void) {
 __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
 
+#ifdef LATENCY_TRACE_ENABLE
+#    ifdef SPLIT_KEYBOARD
+    latency_trace_raw_matrix(raw_matrix, thisHand, ROWS_PER_HAND);
+#    else
+    latency_trace_raw_matrix(raw_matrix, 0, ROWS_PER_HAND);
+#    endif
+#endif
+
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
 #else
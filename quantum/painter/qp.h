@@ -56,6 +56,33 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the number of glyphs whose metadata (width and data offset) is cached, shared across all loaded
+ *      fonts. Cached glyphs skip the ascii/unicode table lookups when measuring or drawing text, with the least recently
+ *      used glyph being replaced when the cache is full. Each entry requires roughly 16 bytes of RAM. Set to 0 to
+ *      disable the cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 16
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_BITMAP_SIZE
+/**
+ * @def This controls the number of bytes of decompressed glyph data held by each glyph cache entry. Glyphs whose
+ *      decompressed data fits are decoded from the font once, and redrawn from RAM afterwards. Requires
+ *      \ref QUANTUM_PAINTER_GLYPH_CACHE_SIZE multiplied by this many bytes of RAM. Set to 0 to disable.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_BITMAP_SIZE 0
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_BITMAP_SIZE
+
+#ifndef QUANTUM_PAINTER_TEXT_LAYOUT_MAX_GLYPHS
+/**
+ * @def This controls the number of glyphs tracked by each \ref qp_text_layout_t, used to work out which glyphs need
+ *      redrawing when the text changes. Glyphs beyond this count are redrawn every time.
+ */
+#    define QUANTUM_PAINTER_TEXT_LAYOUT_MAX_GLYPHS 24
+#endif // QUANTUM_PAINTER_TEXT_LAYOUT_MAX_GLYPHS
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -64,6 +91,15 @@
 #    define QUANTUM_PAINTER_CONCURRENT_ANIMATIONS 4
 #endif // QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 
+#ifndef QUANTUM_PAINTER_ANIMATION_TIME_BUDGET
+/**
+ * @def This controls the amount of time (in milliseconds) that animations may spend rendering during each execution of
+ *      the Quantum Painter internal task. Frames are rendered a few rows at a time, so that large or concurrent
+ *      animations don't stall the main loop. If set to 0, each frame is rendered in its entirety once it is due.
+ */
+#    define QUANTUM_PAINTER_ANIMATION_TIME_BUDGET 1
+#endif // QUANTUM_PAINTER_ANIMATION_TIME_BUDGET
+
 #ifndef QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE
 /**
  * @def This controls the maximum size of the pixel data buffer used for single blocks of transmission. Larger buffers
@@ -72,6 +108,15 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+/**
+ * @def This controls whether a second pixel data buffer is used, so that decoding into one buffer can overlap with the
+ *      transmission of the other. Only comms drivers capable of asynchronous transfers (such as SPI on ChibiOS) benefit
+ *      from this. Requires an additional QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE bytes of RAM.
+ */
+#    define QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -117,6 +162,15 @@ typedef struct painter_image_desc_t {
  */
 typedef const painter_image_desc_t *painter_image_handle_t;
 
+/**
+ * @typedef Rendering statistics for a running animation, retrieved using \ref qp_get_animation_stats.
+ */
+typedef struct qp_animation_stats_t {
+    uint32_t frames_rendered; ///< Number of frames rendered
+    uint32_t frames_dropped;  ///< Number of frames skipped in order to catch up after falling behind
+    uint32_t frames_late;     ///< Number of times the animation fell behind without being able to skip frames, and was resynchronised
+} qp_animation_stats_t;
+
 /**
  * @typedef A descriptor for a Quantum Painter font.
  */
@@ -129,6 +183,22 @@ typedef struct painter_font_desc_t {
  */
 typedef const painter_font_desc_t *painter_font_handle_t;
 
+/**
+ * @typedef Tracks text previously drawn by \ref qp_text_layout_draw, so that only glyphs that changed are redrawn.
+ *          Initialise with \ref qp_text_layout_init; the contents are otherwise internal to Quantum Painter.
+ */
+typedef struct qp_text_layout_t {
+    painter_font_handle_t font;                                                ///< The font used for drawing
+    uint16_t              x;                                                   ///< The x-position of the text
+    uint16_t              y;                                                   ///< The y-position of the text
+    int16_t               width;                                               ///< The width (in pixels) of the text last drawn
+    uint8_t               glyph_count;                                         ///< The number of tracked glyphs last drawn
+    bool                  drawn;                                               ///< Whether the tracked glyphs are present on the display
+    uint8_t               colors[6];                                           ///< The fg/bg HSV values last drawn with
+    uint32_t              code_points[QUANTUM_PAINTER_TEXT_LAYOUT_MAX_GLYPHS]; ///< The code points last drawn
+    uint8_t               widths[QUANTUM_PAINTER_TEXT_LAYOUT_MAX_GLYPHS];      ///< The widths of each code point last drawn
+} qp_text_layout_t;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API
 
@@ -429,6 +499,16 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
  */
 void qp_stop_animation(deferred_token anim_token);
 
+/**
+ * Retrieves the rendering statistics of a running animation.
+ *
+ * @param anim_token[in] the animation token returned by \ref qp_animate, or \ref qp_animate_recolor.
+ * @param stats[out] the statistics of the animation
+ * @return true if the animation is running and statistics were retrieved
+ * @return false if the animation token did not match a running animation
+ */
+bool qp_get_animation_stats(deferred_token anim_token, qp_animation_stats_t *stats);
+
 /**
  * Loads a font into memory.
  *
@@ -488,6 +568,41 @@ int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_fon
  */
 int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
 
+/**
+ * Initialises a text layout, used for text that is redrawn often at the same location, such as status lines.
+ *
+ * @param layout[in] the layout to initialise
+ * @param font[in] the handle of the font
+ * @param x[in] the x-position where the text should be drawn onto the device
+ * @param y[in] the y-position where the text should be drawn onto the device
+ */
+void qp_text_layout_init(qp_text_layout_t *layout, painter_font_handle_t font, uint16_t x, uint16_t y);
+
+/**
+ * Marks a text layout as no longer present on the display, such as after clearing the screen. The next call to
+ * \ref qp_text_layout_draw will redraw every glyph.
+ *
+ * @param layout[in] the layout to invalidate
+ */
+void qp_text_layout_invalidate(qp_text_layout_t *layout);
+
+/**
+ * Draws text using a text layout, only redrawing the glyphs that differ from the text previously drawn with the same
+ * layout. If the new text is narrower than before, the remainder is cleared with the background color.
+ *
+ * @param device[in] the handle of the device to control
+ * @param layout[in] the layout, previously initialised with \ref qp_text_layout_init
+ * @param str[in] the string to draw
+ * @param hue_fg[in] the foreground hue to use, with 0-360 mapped to 0-255
+ * @param sat_fg[in] the foreground saturation to use, with 0-100% mapped to 0-255
+ * @param val_fg[in] the foreground value to use, with 0-100% mapped to 0-255
+ * @param hue_bg[in] the background hue to use, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the background saturation to use, with 0-100% mapped to 0-255
+ * @param val_bg[in] the background value to use, with 0-100% mapped to 0-255
+ * @return the width (in pixels) of the specified string
+ */
+int16_t qp_text_layout_draw(painter_device_t device, qp_text_layout_t *layout, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Drivers
 
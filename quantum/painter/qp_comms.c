@@ -33,6 +33,7 @@ void qp_comms_stop(painter_device_t device) {
         return;
     }
 
+    qp_comms_wait(device);
     driver->comms_vtable->comms_stop(device);
 }
 
@@ -43,15 +44,58 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
         return false;
     }
 
+    qp_comms_wait(device);
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
+uint32_t qp_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_comms_send_async: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    if (driver->comms_vtable->comms_send_async) {
+        // Only one transfer may be in flight at a time
+        qp_comms_wait(device);
+        driver->comms_busy = true;
+        if (!driver->comms_vtable->comms_send_async(device, data, byte_count)) {
+            driver->comms_busy = false;
+            return 0;
+        }
+        return byte_count;
+    }
+#endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
+    return qp_comms_send(device, data, byte_count);
+}
+
+void qp_comms_send_async_complete(painter_device_t device) {
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    painter_driver_t *driver = (painter_driver_t *)device;
+    driver->comms_busy       = false;
+#endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+}
+
+void qp_comms_wait(painter_device_t device) {
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    painter_driver_t *driver = (painter_driver_t *)device;
+    while (driver->comms_busy) {
+        if (driver->comms_vtable->comms_poll) {
+            driver->comms_vtable->comms_poll(device);
+        }
+    }
+#endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
 void qp_comms_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *                   driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+    qp_comms_wait(device);
     comms_vtable->send_command(device, cmd);
 }
 
@@ -68,5 +112,6 @@ uint32_t qp_comms_command_databuf(painter_device_t device, uint8_t cmd, const vo
 void qp_comms_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
     painter_driver_t *                   driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+    qp_comms_wait(device);
     comms_vtable->bulk_command_sequence(device, sequence, sequence_len);
 }
@@ -16,6 +16,12 @@ bool     qp_comms_start(painter_device_t device);
 void     qp_comms_stop(painter_device_t device);
 uint32_t qp_comms_send(painter_device_t device, const void* data, uint32_t byte_count);
 
+// Asynchronous transfers -- `data` must remain untouched until the transfer has completed, which is guaranteed by the
+// time any other comms API for the device returns. Falls back to qp_comms_send() if unsupported by the comms driver.
+uint32_t qp_comms_send_async(painter_device_t device, const void* data, uint32_t byte_count);
+void     qp_comms_send_async_complete(painter_device_t device);
+void     qp_comms_wait(painter_device_t device);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
@@ -10,7 +10,15 @@
 // Quantum Painter utility functions
 
 // Global variable used for native pixel data streaming.
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+extern uint8_t* qp_internal_global_pixdata_buffer;
+#else
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+
+// Sends the first `native_pixel_count` pixels of the global pixdata buffer to the device. The buffer must be refilled
+// from the start afterwards, as it may have been swapped for a second buffer while the first is still in transit.
+bool qp_internal_pixdata_flush(painter_device_t device, uint32_t native_pixel_count);
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
@@ -27,14 +35,8 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 // qp_rect internal implementation, but uses the global pixdata buffer with pre-converted native pixels.
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
-// Convert from input pixel data + palette to equivalent pixels
+// Pulls one decoded byte of input pixel data at a time, see qp_internal_prepare_input_state()
 typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
-typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
-typedef bool (*qp_internal_byte_output_callback)(uint8_t byte, void* cb_arg);
-bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg);
-bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_pixel_output_callback output_callback, void* output_arg);
-bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg);
-bool qp_internal_send_bytes(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_byte_output_callback output_callback, void* output_arg);
 
 // Global variable used for interpolated pixel lookup table.
 #if QUANTUM_PAINTER_SUPPORTS_256_PALETTE
@@ -64,9 +66,10 @@ enum qp_internal_rle_mode_t {
 };
 
 typedef struct qp_internal_byte_input_state_t {
-    painter_device_t device;
-    qp_stream_t*     src_stream;
-    int16_t          curr;
+    painter_device_t      device;
+    qp_stream_t*          src_stream;
+    painter_compression_t compression;
+    int16_t               curr;
     union {
         // RLE-specific
         struct {
@@ -82,19 +85,16 @@ typedef struct qp_internal_pixel_output_state_t {
     uint32_t         max_pixels;
 } qp_internal_pixel_output_state_t;
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg);
-
 typedef struct qp_internal_byte_output_state_t {
     painter_device_t device;
     uint32_t         byte_write_pos;
     uint32_t         max_bytes;
 } qp_internal_byte_output_state_t;
 
-bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
-
-// Helper shared between image and font rendering, sends pixels to the display using:
-//     - qp_internal_decode_palette + qp_internal_pixel_appender (bpp <= 8)
-//     - qp_internal_send_bytes                                  (bpp > 8)
-bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state);
+// Helper shared between image and font rendering, decodes whole spans of the input (as set up by
+// qp_internal_prepare_input_state) straight into the pixdata buffer and sends them to the display:
+//     - as palette indices, converted through the global lookup table (bpp <= 8)
+//     - as raw native pixel bytes                                      (bpp > 8)
+bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_state_t* input_state);
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression);
@@ -9,78 +9,23 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Palette / Monochrome-format decoder
 
-static const qp_pixel_t qp_pixel_white = {.hsv888 = {.h = 0, .s = 0, .v = 255}};
-static const qp_pixel_t qp_pixel_black = {.hsv888 = {.h = 0, .s = 0, .v = 0}};
-
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel) {
 #if !(QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)
 #    if !(QUANTUM_PAINTER_SUPPORTS_256_PALETTE)
     if (bits_per_pixel > 4) {
-        qp_dprintf("qp_internal_decode_palette: image bpp greater than 4\n");
+        qp_dprintf("qp_internal_bpp_capable: image bpp greater than 4\n");
         return false;
     }
 #    endif
 
     if (bits_per_pixel > 8) {
-        qp_dprintf("qp_internal_decode_palette: image bpp greater than 8\n");
+        qp_dprintf("qp_internal_bpp_capable: image bpp greater than 8\n");
         return false;
     }
 #endif
     return true;
 }
 
-bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg) {
-    const uint8_t pixel_bitmask    = (1 << bits_per_pixel) - 1;
-    const uint8_t pixels_per_byte  = 8 / bits_per_pixel;
-    uint32_t      remaining_pixels = pixel_count; // don't try to derive from byte_count, we may not use an entire byte
-    while (remaining_pixels > 0) {
-        int16_t byteval = input_callback(input_arg);
-        if (byteval < 0) {
-            return false;
-        }
-        uint8_t loop_pixels = remaining_pixels < pixels_per_byte ? remaining_pixels : pixels_per_byte;
-        for (uint8_t q = 0; q < loop_pixels; ++q) {
-            if (!output_callback(palette, byteval & pixel_bitmask, output_arg)) {
-                return false;
-            }
-            byteval >>= bits_per_pixel;
-        }
-        remaining_pixels -= loop_pixels;
-    }
-    return true;
-}
-
-bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_pixel_output_callback output_callback, void* output_arg) {
-    return qp_internal_decode_recolor(device, pixel_count, bits_per_pixel, input_callback, input_arg, qp_pixel_white, qp_pixel_black, output_callback, output_arg);
-}
-
-bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg) {
-    painter_driver_t* driver = (painter_driver_t*)device;
-    int16_t           steps  = 1 << bits_per_pixel; // number of items we need to interpolate
-    if (qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, steps)) {
-        if (!driver->driver_vtable->palette_convert(device, steps, qp_internal_global_pixel_lookup_table)) {
-            return false;
-        }
-    }
-
-    return qp_internal_decode_palette(device, pixel_count, bits_per_pixel, input_callback, input_arg, qp_internal_global_pixel_lookup_table, output_callback, output_arg);
-}
-
-bool qp_internal_send_bytes(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_byte_output_callback output_callback, void* output_arg) {
-    uint32_t remaining_bytes = byte_count;
-    while (remaining_bytes > 0) {
-        int16_t byteval = input_callback(input_arg);
-        if (byteval < 0) {
-            return false;
-        }
-        if (!output_callback(byteval, output_arg)) {
-            return false;
-        }
-        remaining_bytes -= 1;
-    }
-    return true;
-}
-
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Progressive pull of bytes, push of pixels
 
@@ -126,47 +71,179 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
-    qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
-    painter_driver_t*                 driver = (painter_driver_t*)state->device;
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Block-oriented decode, expanding whole runs at a time
+
+// Number of palette indices expanded per call into the device's append_pixels
+#define QP_INTERNAL_DECODE_SPAN 64
 
-    if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos++, 1, &index)) {
-        return false;
+// Reads the next span of source bytes. Literal data is copied into `buf`, up to `max_literal` bytes. Repeated RLE runs
+// only populate `buf[0]`, set `*repeated`, and may cover up to `max_repeat` bytes. Returns 0 on failure.
+static uint32_t qp_internal_read_span(qp_internal_byte_input_state_t* state, uint8_t* buf, uint32_t max_literal, uint32_t max_repeat, bool* repeated) {
+    *repeated = false;
+
+    if (state->compression != IMAGE_COMPRESSED_RLE) {
+        return qp_stream_read(buf, 1, max_literal, state->src_stream);
     }
 
-    // If we've hit the transmit limit, send out the entire buffer and reset the write position
-    if (state->pixel_write_pos == state->max_pixels) {
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
-            return false;
+    // Work out if we're parsing the initial marker byte
+    while (state->rle.mode == MARKER_BYTE) {
+        int16_t c = qp_stream_get(state->src_stream);
+        if (c < 0) {
+            return 0;
+        }
+        if (c >= 128) {
+            state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
+            state->rle.remain = c - 127;
+        } else {
+            state->rle.mode   = REPEATING_RUN; // repeated run
+            state->rle.remain = c;
+            state->curr       = qp_stream_get(state->src_stream);
+            if (state->curr < 0) {
+                return 0;
+            }
+        }
+        if (state->rle.remain == 0) {
+            state->rle.mode = MARKER_BYTE;
         }
-        state->pixel_write_pos = 0;
     }
 
+    uint32_t count;
+    if (state->rle.mode == REPEATING_RUN) {
+        count     = QP_MIN(state->rle.remain, max_repeat);
+        buf[0]    = state->curr;
+        *repeated = true;
+    } else {
+        count = qp_stream_read(buf, 1, QP_MIN(state->rle.remain, max_literal), state->src_stream);
+    }
+
+    state->rle.remain -= count;
+    if (state->rle.remain == 0) {
+        state->rle.mode = MARKER_BYTE;
+    }
+    return count;
+}
+
+// Appends a span of palette indices to the pixdata buffer, sending it whenever it fills up
+static bool qp_internal_append_indices(qp_internal_pixel_output_state_t* state, qp_pixel_t* palette, uint8_t* indices, uint32_t count) {
+    painter_driver_t* driver = (painter_driver_t*)state->device;
+    while (count > 0) {
+        uint32_t n = QP_MIN(count, state->max_pixels - state->pixel_write_pos);
+        if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos, n, indices)) {
+            return false;
+        }
+        state->pixel_write_pos += n;
+        indices += n;
+        count -= n;
+
+        // If we've hit the transmit limit, send out the entire buffer and reset the write position
+        if (state->pixel_write_pos == state->max_pixels) {
+            if (!qp_internal_pixdata_flush(state->device, state->pixel_write_pos)) {
+                return false;
+            }
+            state->pixel_write_pos = 0;
+        }
+    }
     return true;
 }
 
-bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
-    qp_internal_byte_output_state_t* state  = (qp_internal_byte_output_state_t*)cb_arg;
-    painter_driver_t*                driver = (painter_driver_t*)state->device;
+static bool qp_internal_decode_palette_spans(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_state_t* input_state, qp_pixel_t* palette, qp_internal_pixel_output_state_t* output_state) {
+    const uint8_t pixel_bitmask    = (1 << bits_per_pixel) - 1;
+    const uint8_t pixels_per_byte  = 8 / bits_per_pixel;
+    uint32_t      remaining_pixels = pixel_count; // don't try to derive from byte_count, we may not use an entire byte
+    uint8_t       src[QP_INTERNAL_DECODE_SPAN];
+    uint8_t       indices[QP_INTERNAL_DECODE_SPAN];
 
-    if (!driver->driver_vtable->append_pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos++, byteval)) {
-        return false;
+    while (remaining_pixels > 0) {
+        uint32_t remaining_bytes = (remaining_pixels + pixels_per_byte - 1) / pixels_per_byte;
+        bool     repeated;
+        uint32_t byte_count = qp_internal_read_span(input_state, src, QP_MIN(remaining_bytes, QP_INTERNAL_DECODE_SPAN / pixels_per_byte), remaining_bytes, &repeated);
+        if (byte_count == 0) {
+            return false;
+        }
+
+        // Expand the source bytes into palette indices -- for repeated runs, a single byte's worth of pixels is repeated
+        // across the whole span so it can be appended as many times as needed
+        uint32_t span_bytes = repeated ? QP_MIN(byte_count, QP_INTERNAL_DECODE_SPAN / pixels_per_byte) : byte_count;
+        uint32_t i          = 0;
+        for (uint32_t b = 0; b < span_bytes; ++b) {
+            uint8_t byteval = repeated ? src[0] : src[b];
+            for (uint8_t q = 0; q < pixels_per_byte; ++q) {
+                indices[i++] = byteval & pixel_bitmask;
+                byteval >>= bits_per_pixel;
+            }
+        }
+
+        uint32_t span_pixels = QP_MIN(byte_count * pixels_per_byte, remaining_pixels);
+        remaining_pixels -= span_pixels;
+        while (span_pixels > 0) {
+            uint32_t n = QP_MIN(span_pixels, i);
+            if (!qp_internal_append_indices(output_state, palette, indices, n)) {
+                return false;
+            }
+            span_pixels -= n;
+        }
     }
+    return true;
+}
 
-    // If we've hit the transmit limit, send out the entire buffer and reset the write position
-    if (state->byte_write_pos == state->max_bytes) {
-        painter_driver_t* driver = (painter_driver_t*)state->device;
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+// Appends a span of native pixel bytes to the pixdata buffer, sending it whenever it fills up
+static bool qp_internal_append_pixdata(qp_internal_byte_output_state_t* state, const uint8_t* pixdata, uint32_t count) {
+    painter_driver_t* driver = (painter_driver_t*)state->device;
+    while (count > 0) {
+        uint32_t n = QP_MIN(count, state->max_bytes - state->byte_write_pos);
+        if (!driver->driver_vtable->append_pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos, n, pixdata)) {
             return false;
         }
-        state->byte_write_pos = 0;
+        state->byte_write_pos += n;
+        pixdata += n;
+        count -= n;
+
+        // If we've hit the transmit limit, send out the entire buffer and reset the write position
+        if (state->byte_write_pos == state->max_bytes) {
+            if (!qp_internal_pixdata_flush(state->device, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+                return false;
+            }
+            state->byte_write_pos = 0;
+        }
     }
+    return true;
+}
+
+static bool qp_internal_send_byte_spans(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_state_t* input_state, qp_internal_byte_output_state_t* output_state) {
+    uint32_t remaining_bytes = byte_count;
+    uint8_t  src[QP_INTERNAL_DECODE_SPAN];
 
+    while (remaining_bytes > 0) {
+        bool     repeated;
+        uint32_t span_bytes = qp_internal_read_span(input_state, src, QP_MIN(remaining_bytes, sizeof(src)), remaining_bytes, &repeated);
+        if (span_bytes == 0) {
+            return false;
+        }
+        remaining_bytes -= span_bytes;
+
+        if (!repeated) {
+            if (!qp_internal_append_pixdata(output_state, src, span_bytes)) {
+                return false;
+            }
+            continue;
+        }
+
+        // Repeated runs fill the span buffer once, then append it as many times as needed
+        memset(src, src[0], QP_MIN(span_bytes, sizeof(src)));
+        while (span_bytes > 0) {
+            uint32_t n = QP_MIN(span_bytes, sizeof(src));
+            if (!qp_internal_append_pixdata(output_state, src, n)) {
+                return false;
+            }
+            span_bytes -= n;
+        }
+    }
     return true;
 }
 
-// Helper shared between image and font rendering -- uses either (qp_internal_decode_palette + qp_internal_pixel_appender) or (qp_internal_send_bytes) to send data data to the display based on the asset's native-ness
-bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
+// Helper shared between image and font rendering -- decodes either palette indices or native pixel bytes, based on the asset's native-ness, and sends them to the display
+bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_state_t* input_state) {
     painter_driver_t* driver = (painter_driver_t*)device;
 
     bool ret = false;
@@ -177,10 +254,10 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
 
         // Decode the pixel data and stream to the display
-        ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
+        ret = qp_internal_decode_palette_spans(device, pixel_count, bpp, input_state, qp_internal_global_pixel_lookup_table, &output_state);
         // Any leftovers need transmission as well.
         if (ret && output_state.pixel_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+            ret &= qp_internal_pixdata_flush(device, output_state.pixel_write_pos);
         }
     }
 
@@ -194,10 +271,10 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
 
         // Stream the raw pixel data to the display
         uint32_t byte_count = pixel_count * bpp / 8;
-        ret                 = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
+        ret                 = qp_internal_send_byte_spans(device, byte_count, input_state, &output_state);
         // Any leftovers need transmission as well.
         if (ret && output_state.byte_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+            ret &= qp_internal_pixdata_flush(device, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
         }
     }
 
@@ -205,6 +282,7 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
 }
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression) {
+    input_state->compression = compression;
     switch (compression) {
         case IMAGE_UNCOMPRESSED:
             return qp_drawimage_byte_uncompressed_decoder;
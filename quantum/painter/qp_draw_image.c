@@ -264,7 +264,7 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
     }
 
     // Decode and stream pixels
-    bool ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
+    bool ret = qp_internal_appender(device, frame_info->bpp, pixel_count, &input_state);
 
     qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
@@ -297,36 +297,181 @@ typedef struct animation_state_t {
     qp_pixel_t             bg_hsv888;
     uint16_t               frame_number;
     deferred_token         defer_token;
+    uint32_t               next_frame_time; // when the frame at frame_number is due to start rendering
+    qp_animation_stats_t   stats;
+
+    // Progressive rendering of the current frame
+    bool                           rendering;
+    bool                           palette_ready; // whether the global palette still matches this frame
+    qgf_frame_info_t               frame_info;
+    uint16_t                       left;
+    uint16_t                       top;
+    uint16_t                       width;
+    uint16_t                       height;
+    uint16_t                       rows_done;
+    uint16_t                       rows_per_slice;
+    int32_t                        stream_pos;
+    qp_internal_byte_input_state_t input_state;
 } animation_state_t;
 
-static deferred_executor_t animation_executors[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
-static animation_state_t   animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS]    = {0};
+static animation_state_t animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
+static deferred_token    animation_last_token                                    = INVALID_DEFERRED_TOKEN;
 
-static deferred_token qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
-    qgf_frame_info_t frame_info = {0};
-    qp_dprintf("qp_render_animation_state: entry (frame #%d)\n", (int)state->frame_number);
-    bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888);
-    if (ret) {
-        ++state->frame_number;
-        if (state->frame_number >= state->image->frame_count) {
-            state->frame_number = 0;
+// Helper that reads only the timing-related information of the specified frame
+static bool qp_animation_peek_frame(qgf_image_handle_t *qgf_image, uint16_t frame_number, bool *is_delta, uint16_t *delay) {
+    qgf_seek_to_frame_descriptor(&qgf_image->stream, frame_number);
+    qgf_frame_v1_t frame_descriptor;
+    if (qp_stream_read(&frame_descriptor, sizeof(qgf_frame_v1_t), 1, &qgf_image->stream) != 1) {
+        return false;
+    }
+    return qgf_parse_frame_descriptor(&frame_descriptor, NULL, NULL, NULL, is_delta, NULL, delay);
+}
+
+static inline uint16_t qp_animation_following_frame(animation_state_t *state, uint16_t frame_number) {
+    return (frame_number + 1 >= state->image->frame_count) ? 0 : frame_number + 1;
+}
+
+// Skips frames while lagging more than a whole frame behind -- only possible when the frame after the one being skipped
+// redraws the entire image, as delta frames rely on the previous frame's contents already being on the display
+static void qp_animation_skip_late_frames(animation_state_t *state, uint32_t now) {
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)state->image;
+    for (uint16_t i = 0; i < state->image->frame_count; ++i) {
+        bool     is_delta;
+        uint16_t delay;
+        if (!qp_animation_peek_frame(qgf_image, state->frame_number, NULL, &delay)) {
+            return;
+        }
+
+        // Nothing to do if the following frame isn't due yet
+        uint32_t following_frame_time = state->next_frame_time + delay;
+        if (!timer_expired32(now, following_frame_time)) {
+            return;
+        }
+
+        uint16_t next_frame = qp_animation_following_frame(state, state->frame_number);
+        if (!qp_animation_peek_frame(qgf_image, next_frame, &is_delta, NULL) || is_delta) {
+            break;
+        }
+
+        qp_dprintf("qp_animation: dropping frame #%d\n", (int)state->frame_number);
+        state->frame_number = next_frame;
+        state->next_frame_time += delay;
+        ++state->stats.frames_dropped;
+    }
+
+    // Still more than a frame behind without being able to drop anything, so restart the timeline instead of trying to catch up
+    ++state->stats.frames_late;
+    state->next_frame_time = now;
+}
+
+static bool qp_animation_begin_frame(animation_state_t *state) {
+    painter_driver_t *  driver    = (painter_driver_t *)state->device;
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)state->image;
+
+    if (!qp_drawimage_prepare_frame_for_stream_read(state->device, qgf_image, state->frame_number, state->fg_hsv888, state->bg_hsv888, &state->frame_info)) {
+        return false;
+    }
+
+    // Delta frames only redraw the changed area
+    if (state->frame_info.is_delta) {
+        state->left   = state->x + state->frame_info.left;
+        state->top    = state->y + state->frame_info.top;
+        state->width  = state->frame_info.right - state->frame_info.left + 1;
+        state->height = state->frame_info.bottom - state->frame_info.top + 1;
+    } else {
+        state->left   = state->x;
+        state->top    = state->y;
+        state->width  = state->image->width;
+        state->height = state->image->height;
+    }
+
+    // Each slice is roughly one pixdata buffer's worth of rows, and must end on a byte boundary of the source data
+    uint8_t  pixels_per_byte = state->frame_info.bpp < 8 ? 8 / state->frame_info.bpp : 1;
+    uint16_t granularity     = 1;
+    while ((granularity * state->width) % pixels_per_byte != 0) {
+        ++granularity;
+    }
+    uint32_t rows         = qp_internal_num_pixels_in_buffer(state->device) / state->width;
+    rows                  = QP_MAX(granularity, rows - (rows % granularity));
+    state->rows_per_slice = (uint16_t)QP_MIN(rows, state->height);
+
+    if (qp_internal_prepare_input_state(&state->input_state, state->frame_info.compression_scheme) == NULL) {
+        qp_dprintf("qp_animation: fail (invalid image compression scheme)\n");
+        return false;
+    }
+
+    if (state->frame_info.bpp > 8 && state->frame_info.bpp != driver->native_bits_per_pixel) {
+        qp_dprintf("qp_animation: fail (image bpp %d doesn't match the display)\n", (int)state->frame_info.bpp);
+        return false;
+    }
+
+    state->stream_pos    = qp_stream_tell(&qgf_image->stream);
+    state->rows_done     = 0;
+    state->palette_ready = true;
+    state->rendering     = true;
+    return true;
+}
+
+static bool qp_animation_render_slice(animation_state_t *state) {
+    painter_driver_t *  driver    = (painter_driver_t *)state->device;
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)state->image;
+
+    // Other drawing may have happened since the previous slice, so restore the palette and the read position
+    if (!state->palette_ready) {
+        qgf_frame_info_t frame_info;
+        if (!qp_drawimage_prepare_frame_for_stream_read(state->device, qgf_image, state->frame_number, state->fg_hsv888, state->bg_hsv888, &frame_info)) {
+            return false;
         }
-        *delay_ms = frame_info.delay;
     }
-    qp_dprintf("qp_render_animation_state: %s (delay %dms)\n", ret ? "ok" : "fail", (int)(*delay_ms));
+    if (qp_stream_setpos(&qgf_image->stream, state->stream_pos) < 0) {
+        return false;
+    }
+
+    if (!qp_comms_start(state->device)) {
+        qp_dprintf("qp_animation: fail (could not start comms)\n");
+        return false;
+    }
+
+    uint16_t rows = QP_MIN(state->rows_per_slice, state->height - state->rows_done);
+    uint16_t t    = state->top + state->rows_done;
+    bool     ret  = driver->driver_vtable->viewport(state->device, state->left, t, state->left + state->width - 1, t + rows - 1);
+    if (ret) {
+        ret = qp_internal_appender(state->device, state->frame_info.bpp, ((uint32_t)state->width) * rows, &state->input_state);
+    }
+    qp_comms_stop(state->device);
+
+    state->stream_pos    = qp_stream_tell(&qgf_image->stream);
+    state->palette_ready = false;
+    state->rows_done += rows;
+    if (state->rows_done >= state->height) {
+        // Frame complete, schedule the next one relative to when this one was due so that lag doesn't accumulate
+        ++state->stats.frames_rendered;
+        state->rendering = false;
+        state->next_frame_time += QP_MAX(state->frame_info.delay, 1);
+        state->frame_number = qp_animation_following_frame(state, state->frame_number);
+    }
     return ret;
 }
 
-static uint32_t animation_callback(uint32_t trigger_time, void *cb_arg) {
-    animation_state_t *state    = (animation_state_t *)cb_arg;
-    uint16_t           delay_ms = 0;
-    bool               ret      = qp_render_animation_state(state, &delay_ms);
-    if (!ret) {
-        // Setting the device to NULL clears the animation slot
+// Performs the next unit of work for the animation, returning false if there was nothing to do
+static bool qp_animation_step(animation_state_t *state, uint32_t now) {
+    if (!state->rendering) {
+        if (!timer_expired32(now, state->next_frame_time)) {
+            return false;
+        }
+        qp_animation_skip_late_frames(state, now);
+        if (!qp_animation_begin_frame(state)) {
+            // Setting the device to NULL clears the animation slot
+            state->device = NULL;
+            return false;
+        }
+    }
+
+    if (!qp_animation_render_slice(state)) {
         state->device = NULL;
+        return false;
     }
-    // If we're successful, keep animating -- returning 0 cancels the deferred execution
-    return ret ? delay_ms : 0;
+    return true;
 }
 
 deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
@@ -346,29 +491,40 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
     }
 
     // Prepare the animation state
-    anim_state->device       = device;
-    anim_state->x            = x;
-    anim_state->y            = y;
-    anim_state->image        = image;
-    anim_state->fg_hsv888    = (qp_pixel_t){.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    anim_state->bg_hsv888    = (qp_pixel_t){.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    anim_state->frame_number = 0;
-
-    // Draw the first frame
-    uint16_t delay_ms;
-    if (!qp_render_animation_state(anim_state, &delay_ms)) {
-        anim_state->device = NULL; // disregard the allocated animation slot
+    memset(anim_state, 0, sizeof(animation_state_t));
+    anim_state->x                      = x;
+    anim_state->y                      = y;
+    anim_state->image                  = image;
+    anim_state->fg_hsv888              = (qp_pixel_t){.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    anim_state->bg_hsv888              = (qp_pixel_t){.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+    anim_state->input_state.device     = device;
+    anim_state->input_state.src_stream = &((qgf_image_handle_t *)image)->stream;
+
+    // Draw the first frame immediately
+    qgf_frame_info_t frame_info = {0};
+    if (!qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, anim_state->fg_hsv888, anim_state->bg_hsv888)) {
         qp_dprintf("qp_animate_recolor: fail (could not render first frame)\n");
         return INVALID_DEFERRED_TOKEN;
     }
+    anim_state->stats.frames_rendered = 1;
+    anim_state->frame_number          = qp_animation_following_frame(anim_state, 0);
+    anim_state->next_frame_time       = timer_read32() + frame_info.delay;
+
+    // Allocate a token not used by any other running animation
+    bool in_use;
+    do {
+        if (++animation_last_token == INVALID_DEFERRED_TOKEN) {
+            ++animation_last_token;
+        }
+        in_use = false;
+        for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
+            in_use |= animation_states[i].device != NULL && animation_states[i].defer_token == animation_last_token;
+        }
+    } while (in_use);
 
-    // Set up the timer
-    anim_state->defer_token = defer_exec_advanced(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, delay_ms, animation_callback, anim_state);
-    if (anim_state->defer_token == INVALID_DEFERRED_TOKEN) {
-        anim_state->device = NULL; // disregard the allocated animation slot
-        qp_dprintf("qp_animate_recolor: fail (could not set up animation executor)\n");
-        return INVALID_DEFERRED_TOKEN;
-    }
+    // Setting the device marks the animation slot as in-use
+    anim_state->defer_token = animation_last_token;
+    anim_state->device      = device;
 
     qp_dprintf("qp_animate_recolor: ok (deferred token = %d)\n", (int)anim_state->defer_token);
     return anim_state->defer_token;
@@ -379,18 +535,51 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
 
 void qp_stop_animation(deferred_token anim_token) {
     for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
-        if (animation_states[i].defer_token == anim_token) {
-            cancel_deferred_exec_advanced(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, anim_token);
+        if (animation_states[i].device != NULL && animation_states[i].defer_token == anim_token) {
             animation_states[i].device = NULL;
             return;
         }
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_get_animation_stats
+
+bool qp_get_animation_stats(deferred_token anim_token, qp_animation_stats_t *stats) {
+    for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
+        if (animation_states[i].device != NULL && animation_states[i].defer_token == anim_token) {
+            *stats = animation_states[i].stats;
+            return true;
+        }
+    }
+    return false;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Core API: qp_internal_animation_tick
 
 void qp_internal_animation_tick(void) {
-    static uint32_t last_anim_exec = 0;
-    deferred_exec_advanced_task(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, &last_anim_exec);
+    static uint8_t next_slot = 0;
+    uint32_t       now       = timer_read32(); // frames becoming due while rendering wait for the next iteration
+
+    // Round-robin over the animations one slice at a time, so that no single animation starves the others, until either
+    // there's nothing left to render or the time budget for this iteration has been used up
+    bool worked;
+    do {
+        worked = false;
+        for (uint8_t n = 0; n < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++n) {
+            uint8_t            i     = (next_slot + n) % QUANTUM_PAINTER_CONCURRENT_ANIMATIONS;
+            animation_state_t *state = &animation_states[i];
+            if (state->device == NULL || !qp_animation_step(state, now)) {
+                continue;
+            }
+            worked = true;
+#if QUANTUM_PAINTER_ANIMATION_TIME_BUDGET > 0
+            if (timer_elapsed32(now) >= (QUANTUM_PAINTER_ANIMATION_TIME_BUDGET)) {
+                next_slot = (i + 1) % QUANTUM_PAINTER_CONCURRENT_ANIMATIONS;
+                return;
+            }
+#endif // QUANTUM_PAINTER_ANIMATION_TIME_BUDGET > 0
+        }
+    } while (worked);
 }
@@ -36,6 +36,40 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0 && QUANTUM_PAINTER_GLYPH_CACHE_BITMAP_SIZE > 0
+#    define QP_GLYPH_CACHE_BITMAPS
+#endif
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+typedef struct qff_glyph_cache_entry_t {
+    qff_font_handle_t *font; // NULL if the entry is unused
+    uint32_t           code_point;
+    uint32_t           data_offset;
+    uint16_t           last_used;
+    uint8_t            width;
+#    ifdef QP_GLYPH_CACHE_BITMAPS
+    uint16_t bitmap_length; // zero if the glyph data hasn't been decoded into the bitmap
+    uint8_t  bitmap[QUANTUM_PAINTER_GLYPH_CACHE_BITMAP_SIZE];
+#    endif // QP_GLYPH_CACHE_BITMAPS
+} qff_glyph_cache_entry_t;
+
+static qff_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_SIZE] = {0};
+static uint16_t                glyph_cache_clock                             = 0;
+
+static void qp_glyph_cache_evict_font(qff_font_handle_t *qff_font) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++i) {
+        if (glyph_cache[i].font == qff_font) {
+            glyph_cache[i].font = NULL;
+        }
+    }
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -151,6 +185,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Drop any cached glyphs belonging to this font
+    qp_glyph_cache_evict_font(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -161,7 +200,8 @@ bool qp_close_font(painter_font_handle_t font) {
 // Helpers
 
 // Callback to be invoked for each codepoint detected in the UTF8 input string
-typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg);
+typedef struct qff_glyph_info_t qff_glyph_info_t;
+typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, const qff_glyph_info_t *glyph, void *cb_arg);
 
 // Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
 static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
@@ -214,7 +254,8 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     return true;
 }
 
-static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+// Helper that looks up the width and data offset of a glyph from the font's ascii/unicode tables
+static bool qp_drawtext_find_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width, uint32_t *offset) {
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
         qff_ascii_glyph_v1_t glyph_info;
@@ -240,12 +281,8 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
                                + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
                                + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
 
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
+        *width  = glyph_width;
+        *offset = data_offset;
         return true;
     } else {
         // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
@@ -275,12 +312,8 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
                                        + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
                                        + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
 
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
-
-                *width = glyph_width;
+                *width  = glyph_width;
+                *offset = data_offset;
                 return true;
             }
         }
@@ -292,6 +325,128 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
     return false;
 }
 
+// Information about a single glyph, as needed for measurement and rendering
+struct qff_glyph_info_t {
+    uint32_t data_offset;
+    uint8_t  width;
+#ifdef QP_GLYPH_CACHE_BITMAPS
+    qff_glyph_cache_entry_t *cache_entry;
+#endif // QP_GLYPH_CACHE_BITMAPS
+};
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+// Helper that returns the cache entry for the glyph, looking it up in the font and replacing the least recently used entry if it isn't already cached
+static qff_glyph_cache_entry_t *qp_glyph_cache_lookup(qff_font_handle_t *qff_font, uint32_t code_point) {
+    qff_glyph_cache_entry_t *victim  = &glyph_cache[0];
+    uint32_t                 max_age = 0;
+    uint16_t                 now     = ++glyph_cache_clock;
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++i) {
+        qff_glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->font == qff_font && entry->code_point == code_point) {
+            entry->last_used = now;
+            return entry;
+        }
+
+        // Unused entries are always preferred over the least recently used one
+        uint32_t age = entry->font ? (uint16_t)(now - entry->last_used) : UINT32_MAX;
+        if (age > max_age) {
+            max_age = age;
+            victim  = entry;
+        }
+    }
+
+    uint8_t  width;
+    uint32_t data_offset;
+    if (!qp_drawtext_find_glyph(qff_font, code_point, &width, &data_offset)) {
+        return NULL;
+    }
+
+    victim->font        = qff_font;
+    victim->code_point  = code_point;
+    victim->data_offset = data_offset;
+    victim->width       = width;
+    victim->last_used   = now;
+#    ifdef QP_GLYPH_CACHE_BITMAPS
+    victim->bitmap_length = 0;
+#    endif // QP_GLYPH_CACHE_BITMAPS
+    return victim;
+}
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+// Helper that retrieves the glyph information, through the glyph cache if enabled
+static inline bool qp_drawtext_get_glyph(qff_font_handle_t *qff_font, uint32_t code_point, qff_glyph_info_t *glyph) {
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    qff_glyph_cache_entry_t *entry = qp_glyph_cache_lookup(qff_font, code_point);
+    if (!entry) {
+        return false;
+    }
+    glyph->width       = entry->width;
+    glyph->data_offset = entry->data_offset;
+#    ifdef QP_GLYPH_CACHE_BITMAPS
+    glyph->cache_entry = entry;
+#    endif // QP_GLYPH_CACHE_BITMAPS
+    return true;
+#else  // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    return qp_drawtext_find_glyph(qff_font, code_point, &glyph->width, &glyph->data_offset);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+}
+
+#ifdef QP_GLYPH_CACHE_BITMAPS
+// Helper that decompresses the glyph data into its cache entry, if it fits
+static inline void qp_drawtext_cache_glyph_bitmap(qff_font_handle_t *qff_font, qff_glyph_cache_entry_t *entry, uint32_t byte_count) {
+    if (entry->bitmap_length > 0 || byte_count > QUANTUM_PAINTER_GLYPH_CACHE_BITMAP_SIZE) {
+        return;
+    }
+
+    if (qp_stream_setpos(&qff_font->stream, entry->data_offset) < 0) {
+        return;
+    }
+
+    qp_internal_byte_input_state_t  input_state    = {.src_stream = &qff_font->stream};
+    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, qff_font->compression_scheme);
+    for (uint32_t i = 0; i < byte_count; ++i) {
+        int16_t byteval = input_callback(&input_state);
+        if (byteval < 0) {
+            return;
+        }
+        entry->bitmap[i] = (uint8_t)byteval;
+    }
+    entry->bitmap_length = byte_count;
+}
+#endif // QP_GLYPH_CACHE_BITMAPS
+
+// Helper that renders a single glyph at the specified location, expects the palette to have already been set up
+static bool qp_drawtext_draw_glyph(painter_device_t device, qff_font_handle_t *qff_font, const qff_glyph_info_t *glyph, uint16_t x, uint16_t y) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+
+    // Configure where we're going to be rendering to
+    const uint8_t height = qff_font->base.line_height;
+    driver->driver_vtable->viewport(device, x, y, x + glyph->width - 1, y + height - 1);
+
+    uint32_t pixel_count = ((uint32_t)glyph->width) * height;
+
+#ifdef QP_GLYPH_CACHE_BITMAPS
+    // Render from RAM if the decompressed glyph data is (or can be) held in the cache
+    qp_drawtext_cache_glyph_bitmap(qff_font, glyph->cache_entry, (pixel_count * qff_font->bpp + 7) / 8);
+    if (glyph->cache_entry->bitmap_length > 0) {
+        qp_memory_stream_t             bitmap_stream = qp_make_memory_stream(glyph->cache_entry->bitmap, glyph->cache_entry->bitmap_length);
+        qp_internal_byte_input_state_t input_state   = {.device = device, .src_stream = &bitmap_stream.base};
+        qp_internal_prepare_input_state(&input_state, IMAGE_UNCOMPRESSED);
+        return qp_internal_appender(device, qff_font->bpp, pixel_count, &input_state);
+    }
+#endif // QP_GLYPH_CACHE_BITMAPS
+
+    if (qp_stream_setpos(&qff_font->stream, glyph->data_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        return false;
+    }
+
+    // Decode the pixel data for the glyph, and stream it
+    qp_internal_byte_input_state_t input_state = {.device = device, .src_stream = &qff_font->stream};
+    qp_internal_prepare_input_state(&input_state, qff_font->compression_scheme);
+    return qp_internal_appender(device, qff_font->bpp, pixel_count, &input_state);
+}
+
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
 static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, code_point_handler handler, void *cb_arg) {
     while (*str) {
@@ -302,13 +457,13 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
             return false;
         }
 
-        uint8_t width;
-        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        qff_glyph_info_t glyph;
+        if (!qp_drawtext_get_glyph(qff_font, code_point, &glyph)) {
             qp_dprintf("Failed to prepare glyph for rendering.\n");
             return false;
         }
 
-        if (!handler(qff_font, code_point, width, qff_font->base.line_height, cb_arg)) {
+        if (!handler(qff_font, code_point, &glyph, cb_arg)) {
             qp_dprintf("Failed to execute glyph handler.\n");
             return false;
         }
@@ -325,11 +480,11 @@ typedef struct code_point_iter_calcwidth_state_t {
 } code_point_iter_calcwidth_state_t;
 
 // Codepoint handler callback: width calc
-static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_font, uint32_t code_point, const qff_glyph_info_t *glyph, void *cb_arg) {
     code_point_iter_calcwidth_state_t *state = (code_point_iter_calcwidth_state_t *)cb_arg;
 
     // Increment the overall width by this glyph's width
-    state->width += width;
+    state->width += glyph->width;
 
     return true;
 }
@@ -339,34 +494,71 @@ static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_f
 
 // Callback state
 typedef struct code_point_iter_drawglyph_state_t {
-    painter_device_t                  device;
-    int16_t                           xpos;
-    int16_t                           ypos;
-    qp_internal_byte_input_callback   input_callback;
-    qp_internal_byte_input_state_t *  input_state;
-    qp_internal_pixel_output_state_t *output_state;
+    painter_device_t device;
+    int16_t          xpos;
+    int16_t          ypos;
 } code_point_iter_drawglyph_state_t;
 
 // Codepoint handler callback: drawing
-static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
-    code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
-    painter_driver_t *                 driver = (painter_driver_t *)state->device;
+static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, const qff_glyph_info_t *glyph, void *cb_arg) {
+    code_point_iter_drawglyph_state_t *state = (code_point_iter_drawglyph_state_t *)cb_arg;
 
-    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
-    state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
+    // Render the glyph, then move the x-position for the next glyph
+    bool ret = qp_drawtext_draw_glyph(state->device, qff_font, glyph, state->xpos, state->ypos);
+    state->xpos += glyph->width;
+    return ret;
+}
 
-    // Reset the output state
-    state->output_state->pixel_write_pos = 0;
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Text layout implementation
 
-    // Configure where we're going to be rendering to
-    driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + width - 1, state->ypos + height - 1);
+// Callback state
+typedef struct code_point_iter_layout_state_t {
+    painter_device_t  device;
+    qp_text_layout_t *layout;
+    bool              force_redraw;
+    bool              font_prepared;
+    qp_pixel_t        fg_hsv888;
+    qp_pixel_t        bg_hsv888;
+    uint8_t           index;
+    int16_t           xpos;
+    int16_t           old_xpos;
+} code_point_iter_layout_state_t;
+
+// Codepoint handler callback: layout, only drawing glyphs that differ from the previous text
+static inline bool qp_font_code_point_handler_layout(qff_font_handle_t *qff_font, uint32_t code_point, const qff_glyph_info_t *glyph, void *cb_arg) {
+    code_point_iter_layout_state_t *state  = (code_point_iter_layout_state_t *)cb_arg;
+    qp_text_layout_t *              layout = state->layout;
+
+    // Glyphs are unchanged if the same code point was previously drawn at the same location
+    bool unchanged = false;
+    if (state->index < QUANTUM_PAINTER_TEXT_LAYOUT_MAX_GLYPHS) {
+        if (state->index < layout->glyph_count) {
+            unchanged = layout->code_points[state->index] == code_point && state->old_xpos == state->xpos;
+            state->old_xpos += layout->widths[state->index];
+        }
+        layout->code_points[state->index] = code_point;
+        layout->widths[state->index]      = glyph->width;
+        ++state->index;
+    }
 
-    // Move the x-position for the next glyph
-    state->xpos += width;
+    if (state->force_redraw || !unchanged) {
+        // Palette setup is deferred until there's something to draw
+        if (!state->font_prepared) {
+            uint32_t data_offset;
+            if (!qp_drawtext_prepare_font_for_render(state->device, qff_font, state->fg_hsv888, state->bg_hsv888, &data_offset)) {
+                return false;
+            }
+            state->font_prepared = true;
+        }
 
-    // Decode the pixel data for the glyph, and stream it
-    uint32_t pixel_count = ((uint32_t)width) * height;
-    return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
+        if (!qp_drawtext_draw_glyph(state->device, qff_font, glyph, layout->x + state->xpos, layout->y)) {
+            return false;
+        }
+    }
+
+    state->xpos += glyph->width;
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -411,33 +603,20 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
         return false;
     }
 
-    if (!qp_comms_start(device)) {
-        qp_dprintf("qp_drawtext_recolor: fail (could not start comms)\n");
-        return 0;
-    }
-
-    // Set up the byte input state and input callback
-    qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qff_font->stream};
-    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, qff_font->compression_scheme);
-    if (input_callback == NULL) {
+    // Make sure we can decode the font's pixel data
+    qp_internal_byte_input_state_t input_state = {.device = device, .src_stream = &qff_font->stream};
+    if (qp_internal_prepare_input_state(&input_state, qff_font->compression_scheme) == NULL) {
         qp_dprintf("qp_drawtext_recolor: fail (invalid font compression scheme)\n");
-        qp_comms_stop(device);
         return false;
     }
 
-    // Set up the pixel output state
-    qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_drawtext_recolor: fail (could not start comms)\n");
+        return 0;
+    }
 
     // Set up the codepoint iteration state
-    code_point_iter_drawglyph_state_t state = {// Common
-                                               .device = device,
-                                               .xpos   = x,
-                                               .ypos   = y,
-                                               // Input
-                                               .input_callback = input_callback,
-                                               .input_state    = &input_state,
-                                               // Output
-                                               .output_state = &output_state};
+    code_point_iter_drawglyph_state_t state = {.device = device, .xpos = x, .ypos = y};
 
     qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
@@ -455,3 +634,85 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
     qp_comms_stop(device);
     return ret ? (state.xpos - x) : 0;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_text_layout_init
+
+void qp_text_layout_init(qp_text_layout_t *layout, painter_font_handle_t font, uint16_t x, uint16_t y) {
+    memset(layout, 0, sizeof(qp_text_layout_t));
+    layout->font = font;
+    layout->x    = x;
+    layout->y    = y;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_text_layout_invalidate
+
+void qp_text_layout_invalidate(qp_text_layout_t *layout) {
+    layout->drawn = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_text_layout_draw
+
+int16_t qp_text_layout_draw(painter_device_t device, qp_text_layout_t *layout, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_dprintf("qp_text_layout_draw: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_text_layout_draw: fail (validation_ok == false)\n");
+        return 0;
+    }
+
+    qff_font_handle_t *qff_font = (qff_font_handle_t *)layout->font;
+    if (!qff_font || !qff_font->validate_ok) {
+        qp_dprintf("qp_text_layout_draw: fail (invalid font)\n");
+        return 0;
+    }
+
+    // Make sure we can decode the font's pixel data
+    qp_internal_byte_input_state_t input_state = {.device = device, .src_stream = &qff_font->stream};
+    if (qp_internal_prepare_input_state(&input_state, qff_font->compression_scheme) == NULL) {
+        qp_dprintf("qp_text_layout_draw: fail (invalid font compression scheme)\n");
+        return 0;
+    }
+
+    // Everything needs redrawing if the colors changed, or the previous text isn't on the display
+    const uint8_t colors[6] = {hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg};
+    bool          force     = !layout->drawn || memcmp(layout->colors, colors, sizeof(colors)) != 0;
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_text_layout_draw: fail (could not start comms)\n");
+        return 0;
+    }
+
+    // Set up the codepoint iteration state
+    code_point_iter_layout_state_t state = {
+        .device        = device,
+        .layout        = layout,
+        .force_redraw  = force,
+        .font_prepared = false,
+        .fg_hsv888     = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}},
+        .bg_hsv888     = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}},
+        .index         = 0,
+        .xpos          = 0,
+        .old_xpos      = 0,
+    };
+
+    // Iterate the codepoints with the layout callback
+    bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_layout, &state);
+    qp_comms_stop(device);
+
+    // Clear out anything left over from wider text drawn previously
+    if (ret && layout->drawn && state.xpos < layout->width) {
+        ret = qp_rect(device, layout->x + state.xpos, layout->y, layout->x + layout->width - 1, layout->y + qff_font->base.line_height - 1, hue_bg, sat_bg, val_bg, true);
+    }
+
+    // On failure, the display contents are unknown -- force a full redraw next time
+    layout->drawn       = ret;
+    layout->glyph_count = state.index;
+    layout->width       = state.xpos;
+    memcpy(layout->colors, colors, sizeof(colors));
+
+    qp_dprintf("qp_text_layout_draw: %s\n", ret ? "ok" : "fail");
+    return ret ? state.xpos : 0;
+}
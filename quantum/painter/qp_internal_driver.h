@@ -16,7 +16,7 @@ typedef bool (*painter_driver_viewport_func)(painter_device_t device, uint16_t l
 typedef bool (*painter_driver_pixdata_func)(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count);
 typedef bool (*painter_driver_convert_palette_func)(painter_device_t device, int16_t palette_size, qp_pixel_t *palette);
 typedef bool (*painter_driver_append_pixels)(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices);
-typedef bool (*painter_driver_append_pixdata)(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte);
+typedef bool (*painter_driver_append_pixdata)(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint32_t pixdata_byte_count, const uint8_t *pixdata);
 
 // Driver vtable definition
 typedef struct painter_driver_vtable_t {
@@ -38,12 +38,19 @@ typedef bool (*painter_driver_comms_init_func)(painter_device_t device);
 typedef bool (*painter_driver_comms_start_func)(painter_device_t device);
 typedef void (*painter_driver_comms_stop_func)(painter_device_t device);
 typedef uint32_t (*painter_driver_comms_send_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef bool (*painter_driver_comms_send_async_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef void (*painter_driver_comms_poll_func)(painter_device_t device);
 
 typedef struct painter_comms_vtable_t {
     painter_driver_comms_init_func  comms_init;
     painter_driver_comms_start_func comms_start;
     painter_driver_comms_stop_func  comms_stop;
     painter_driver_comms_send_func  comms_send;
+
+    // Optional asynchronous transfer support -- the comms driver must invoke qp_comms_send_async_complete() once each
+    // transfer started by comms_send_async has finished. comms_poll is invoked repeatedly while waiting for completion.
+    painter_driver_comms_send_async_func comms_send_async;
+    painter_driver_comms_poll_func       comms_poll;
 } painter_comms_vtable_t;
 
 typedef void (*painter_driver_comms_send_command_func)(painter_device_t device, uint8_t cmd);
@@ -81,6 +88,11 @@ typedef struct painter_driver_t {
 
     // Comms config pointer -- needs to point to an appropriate comms config if the comms driver requires it.
     void *comms_config;
+
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    // Whether an asynchronous transfer is still in flight
+    volatile bool comms_busy;
+#endif // QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
 } painter_driver_t;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define MATRIX_ROWS 1
+#define MATRIX_COLS 1
+
+#define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 32
+#define QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER 1
@@ -0,0 +1,89 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
+#include "qp_comms_dummy.h"
+}
+
+// Streams pixel data the same way the TFT panel drivers do, so that each flush starts an asynchronous transfer
+static bool mock_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    qp_comms_send_async(device, pixel_data, native_pixel_count * driver->native_bits_per_pixel / 8);
+    return true;
+}
+
+class PixdataDoubleBuffer : public ::testing::Test {
+   protected:
+    painter_driver_vtable_t driver_vtable = {};
+    painter_driver_t        driver        = {};
+    uint32_t                pixel_count   = 0;
+
+    void SetUp() override {
+        driver_vtable.pixdata        = mock_pixdata;
+        driver.driver_vtable         = &driver_vtable;
+        driver.comms_vtable          = &dummy_comms_vtable;
+        driver.validate_ok           = true;
+        driver.native_bits_per_pixel = 16;
+        pixel_count                  = qp_internal_num_pixels_in_buffer(&driver);
+        dummy_comms_async_stats      = {};
+    }
+
+    void TearDown() override {
+        // Leave no transfer pending for the next test
+        qp_comms_wait(&driver);
+    }
+
+    bool fill_and_flush(uint8_t value) {
+        memset(qp_internal_global_pixdata_buffer, value, QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE);
+        return qp_internal_pixdata_flush(&driver, pixel_count);
+    }
+};
+
+TEST_F(PixdataDoubleBuffer, FlushAlternatesBuffers) {
+    uint8_t *first  = qp_internal_global_pixdata_buffer;
+    uint8_t *second = nullptr;
+
+    for (uint8_t i = 0; i < 8; ++i) {
+        uint8_t *sent = qp_internal_global_pixdata_buffer;
+        EXPECT_TRUE(fill_and_flush(i));
+        EXPECT_TRUE(driver.comms_busy);
+        EXPECT_NE(qp_internal_global_pixdata_buffer, sent);
+        EXPECT_EQ(dummy_comms_async_stats.transfers, i + 1u);
+
+        if (i == 0) {
+            second = qp_internal_global_pixdata_buffer;
+        }
+        EXPECT_EQ(qp_internal_global_pixdata_buffer, (i % 2) ? first : second);
+    }
+
+    qp_comms_wait(&driver);
+    EXPECT_FALSE(driver.comms_busy);
+    EXPECT_EQ(dummy_comms_async_stats.overwrites, 0u);
+}
+
+TEST_F(PixdataDoubleBuffer, BusyBufferIsNotOverwritten) {
+    // Each flush refills the buffer that isn't in flight, and waits for the previous transfer before starting the next
+    for (uint8_t i = 0; i < 8; ++i) {
+        EXPECT_TRUE(fill_and_flush(0x10 + i));
+        EXPECT_EQ(dummy_comms_async_stats.overwrites, 0u);
+    }
+
+    qp_comms_wait(&driver);
+    EXPECT_EQ(dummy_comms_async_stats.transfers, 8u);
+    EXPECT_EQ(dummy_comms_async_stats.overwrites, 0u);
+}
+
+TEST_F(PixdataDoubleBuffer, OverwriteBeforeWaitIsDetected) {
+    uint8_t *sent = qp_internal_global_pixdata_buffer;
+    EXPECT_TRUE(fill_and_flush(0x55));
+
+    // Modifying the buffer that is still being transferred must be caught once the transfer is waited upon
+    sent[0] = 0xAA;
+    qp_comms_wait(&driver);
+    EXPECT_EQ(dummy_comms_async_stats.overwrites, 1u);
+}
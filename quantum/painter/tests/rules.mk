@@ -0,0 +1,10 @@
+qp_pixdata_double_buffer_DEFS := -DEEPROM_TEST_HARNESS -DQUANTUM_PAINTER_ENABLE -DQUANTUM_PAINTER_DUMMY_COMMS_ENABLE
+qp_pixdata_double_buffer_INC := $(QUANTUM_PATH)/painter $(DRIVER_PATH)/painter/comms
+qp_pixdata_double_buffer_CONFIG := $(QUANTUM_PATH)/painter/tests/config_mock.h
+
+qp_pixdata_double_buffer_SRC := \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(DRIVER_PATH)/painter/comms/qp_comms_dummy.c \
+	$(QUANTUM_PATH)/painter/tests/qp_pixdata_tests.cpp
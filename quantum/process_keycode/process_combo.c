@@ -26,6 +26,9 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -264,7 +267,6 @@ static inline void dump_key_buffer(void) {
     key_buffer_next = key_buffer_size = 0;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -338,6 +340,11 @@ void apply_combo(uint16_t combo_index, combo_t *combo) {
         }
 
         KEY_STATE_DOWN(state, key_index);
+#ifdef LATENCY_TRACE_ENABLE
+        if (IS_KEYEVENT(record->event)) {
+            latency_trace_key(record->event.key, record->event.pressed, LATENCY_STAGE_RELEASE);
+        }
+#endif
         if (ALL_COMBO_KEYS_ARE_DOWN(state, key_count)) {
             // this in the end executes the combo when the key_buffer is dumped.
             record->keycode    = combo->keycode;
@@ -422,16 +429,7 @@ static bool keys_pressed_in_order(uint16_t combo_index, combo_t *combo, uint16_t
 }
 #endif
 
-static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
-    uint8_t  key_count = 0;
-    uint16_t key_index = -1;
-    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
-
-    /* Continue processing if key isn't part of current combo. */
-    if (-1 == (int16_t)key_index) {
-        return COMBO_KEY_NOT_PRESSED;
-    }
-
+static combo_key_action_t process_single_combo_key(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index, uint16_t key_index, uint8_t key_count) {
     bool key_is_part_of_combo = (!COMBO_DISABLED(combo) && is_combo_enabled()
 #if defined(COMBO_MUST_PRESS_IN_ORDER) || defined(COMBO_MUST_PRESS_IN_ORDER_PER_COMBO)
                                  && keys_pressed_in_order(combo_index, combo, key_index, keycode, record)
@@ -551,9 +549,128 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
     return key_is_part_of_combo ? COMBO_KEY_PRESSED : COMBO_KEY_NOT_PRESSED;
 }
 
+static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
+    uint8_t  key_count = 0;
+    uint16_t key_index = -1;
+    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
+
+    /* Continue processing if key isn't part of current combo. */
+    if (-1 == (int16_t)key_index) {
+        return COMBO_KEY_NOT_PRESSED;
+    }
+
+    return process_single_combo_key(combo, keycode, record, combo_index, key_index, key_count);
+}
+
+#ifdef COMBO_INDEX_SIZE
+/* Reverse index from keycode to the combos that contain it, sorted by keycode and then by combo index. Looking up a
+ * keycode yields its combos in the same order as walking key_combos[] would, so overlap resolution is unchanged. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+    uint8_t  key_index;
+    uint8_t  key_count;
+} combo_index_entry_t;
+
+static combo_index_entry_t combo_index[COMBO_INDEX_SIZE];
+static uint16_t            combo_index_length = 0;
+static uint16_t            combo_index_combos = 0;
+static bool                combo_index_built  = false;
+static bool                combo_index_usable = false;
+
+void combo_index_invalidate(void) {
+    combo_index_built = false;
+}
+
+static inline bool combo_index_entry_before(const combo_index_entry_t *a, const combo_index_entry_t *b) {
+    return a->keycode != b->keycode ? a->keycode < b->keycode : a->combo_index < b->combo_index;
+}
+
+// Moves the entry at root down the heap of the first length entries until both of its children sort before it
+static void combo_index_sift_down(uint16_t root, uint16_t length) {
+    for (uint16_t child; (child = 2 * root + 1) < length; root = child) {
+        if (child + 1 < length && combo_index_entry_before(&combo_index[child], &combo_index[child + 1])) {
+            child++;
+        }
+        if (!combo_index_entry_before(&combo_index[root], &combo_index[child])) {
+            return;
+        }
+        combo_index_entry_t tmp = combo_index[root];
+        combo_index[root]       = combo_index[child];
+        combo_index[child]      = tmp;
+    }
+}
+
+static void combo_index_build(void) {
+    combo_index_built  = true;
+    combo_index_usable = false;
+    combo_index_length = 0;
+    combo_index_combos = combo_count();
+
+    for (uint16_t idx = 0; idx < combo_index_combos; ++idx) {
+        combo_t *combo     = combo_get(idx);
+        uint8_t  key_count = 0;
+        while (pgm_read_word(&combo->keys[key_count]) != COMBO_END) {
+            key_count++;
+        }
+
+        for (uint8_t key_index = 0; key_index < key_count; key_index++) {
+            uint16_t keycode = pgm_read_word(&combo->keys[key_index]);
+
+            // A keycode listed twice in one combo resolves to its last position, as _find_key_index_and_count() does
+            bool listed_later = false;
+            for (uint8_t later = key_index + 1; later < key_count; later++) {
+                if (pgm_read_word(&combo->keys[later]) == keycode) {
+                    listed_later = true;
+                    break;
+                }
+            }
+            if (listed_later) continue;
+
+            if (combo_index_length >= COMBO_INDEX_SIZE) {
+                // Too small for this keymap, so keep walking every combo instead
+                return;
+            }
+
+            combo_index[combo_index_length++] = (combo_index_entry_t){
+                .keycode     = keycode,
+                .combo_index = idx,
+                .key_index   = key_index,
+                .key_count   = key_count,
+            };
+        }
+    }
+
+    // Heapsort by keycode and then combo index, which keeps each keycode's combos in index order
+    for (uint16_t root = combo_index_length / 2; root-- > 0;) {
+        combo_index_sift_down(root, combo_index_length);
+    }
+    for (uint16_t end = combo_index_length; end-- > 1;) {
+        combo_index_entry_t tmp = combo_index[0];
+        combo_index[0]          = combo_index[end];
+        combo_index[end]        = tmp;
+        combo_index_sift_down(0, end);
+    }
+
+    combo_index_usable = true;
+}
+
+static uint16_t combo_index_find(uint16_t keycode) {
+    uint16_t low = 0, high = combo_index_length;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (combo_index[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+#endif
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    uint8_t is_combo_key          = COMBO_KEY_NOT_PRESSED;
-    bool    no_combo_keys_pressed = true;
+    uint8_t is_combo_key = COMBO_KEY_NOT_PRESSED;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -581,10 +698,24 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_INDEX_SIZE
+    // Normally built by combo_init(), this only catches combos served dynamically that have since changed
+    if (!combo_index_built || combo_index_combos != combo_count()) {
+        combo_index_build();
+    }
+    if (combo_index_usable) {
+        // Only the combos containing this keycode can change state
+        for (uint16_t i = combo_index_find(keycode); i < combo_index_length && combo_index[i].keycode == keycode; ++i) {
+            combo_index_entry_t *entry = &combo_index[i];
+            is_combo_key |= process_single_combo_key(combo_get(entry->combo_index), keycode, record, entry->combo_index, entry->key_index, entry->key_count);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -609,6 +740,9 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
                     .keycode     = keycode,
                     .combo_index = -1, // this will be set when applying combos
                 };
+#ifdef LATENCY_TRACE_ENABLE
+                latency_trace_hold(record->event.key, record->event.pressed);
+#endif
             }
         }
     } else {
@@ -627,6 +761,12 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     return !is_combo_key;
 }
 
+void combo_init(void) {
+#ifdef COMBO_INDEX_SIZE
+    combo_index_build();
+#endif
+}
+
 void combo_task(void) {
     if (!b_combo_enable) {
         return;
@@ -74,6 +74,7 @@ typedef struct combo_t {
 #define KEYCODE_IS_MOD(code) (IS_MODIFIER_KEYCODE(code) || (IS_QK_MODS(code) && !QK_MODS_GET_BASIC_KEYCODE(code)))
 
 bool process_combo(uint16_t keycode, keyrecord_t *record);
+void combo_init(void);
 void combo_task(void);
 void process_combo_event(uint16_t combo_index, bool pressed);
 
@@ -81,3 +82,9 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_INDEX_SIZE
+/* Rebuilds the keycode to combo index before the next key event. Only needed when combo_get() serves combos whose
+ * keys change at runtime without combo_count() changing. */
+void combo_index_invalidate(void);
+#endif
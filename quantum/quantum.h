@@ -66,6 +66,14 @@
 #    include "deferred_exec.h"
 #endif
 
+#ifdef IDLE_SCHEDULER_ENABLE
+#    include "idle_scheduler.h"
+#endif
+
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
 extern layer_state_t default_layer_state;
 
 #ifndef NO_ACTION_LAYER
@@ -8,14 +8,27 @@ bool effect_runner_reactive_splash(uint8_t start, effect_params_t* params, react
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
     uint8_t count = g_last_hit_tracker.count;
+#    ifdef RGB_MATRIX_HIT_DISTANCE_CACHE
+    uint8_t* distances[LED_HITS_TO_REMEMBER];
+    for (uint8_t j = start; j < count; j++) {
+        distances[j] = rgb_matrix_hit_distances(g_last_hit_tracker.index[j]);
+    }
+#    endif
     for (uint8_t i = led_min; i < led_max; i++) {
         RGB_MATRIX_TEST_LED_FLAGS();
         hsv_t hsv = rgb_matrix_config.hsv;
         hsv.v     = 0;
         for (uint8_t j = start; j < count; j++) {
-            int16_t  dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
-            int16_t  dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
-            uint8_t  dist = sqrt16(dx * dx + dy * dy);
+            int16_t dx = g_led_config.point[i].x - g_last_hit_tracker.x[j];
+            int16_t dy = g_led_config.point[i].y - g_last_hit_tracker.y[j];
+#    ifdef RGB_MATRIX_HIT_DISTANCE_CACHE
+            uint8_t dist = distances[j][i];
+            if (dist == RGB_MATRIX_HIT_DISTANCE_UNKNOWN) {
+                dist = distances[j][i] = sqrt16(dx * dx + dy * dy);
+            }
+#    else
+            uint8_t dist = sqrt16(dx * dx + dy * dy);
+#    endif
             uint16_t tick = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
             hsv           = effect_func(hsv, dx, dy, dist, tick);
         }
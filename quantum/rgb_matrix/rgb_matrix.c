@@ -69,6 +69,41 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_HIT_DISTANCE_CACHE
+// One row of LED distances per hit origin, filled in lazily by the reactive runners
+static uint8_t hit_distance_origin[LED_HITS_TO_REMEMBER];
+static uint8_t hit_distance_rows[LED_HITS_TO_REMEMBER][RGB_MATRIX_LED_COUNT];
+
+uint8_t *rgb_matrix_hit_distances(uint8_t origin) {
+    uint8_t row = 0;
+    for (row = 0; row < LED_HITS_TO_REMEMBER; row++) {
+        if (hit_distance_origin[row] == origin) {
+            return hit_distance_rows[row];
+        }
+    }
+
+    // Reuse a row that no remembered hit refers to -- there is always one, as `origin` itself has no row yet
+    for (row = 0; row < LED_HITS_TO_REMEMBER; row++) {
+        bool in_use = false;
+        for (uint8_t j = 0; j < g_last_hit_tracker.count; j++) {
+            if (g_last_hit_tracker.index[j] == hit_distance_origin[row]) {
+                in_use = true;
+                break;
+            }
+        }
+        if (!in_use) break;
+    }
+    if (row >= LED_HITS_TO_REMEMBER) row = 0;
+
+    hit_distance_origin[row] = origin;
+    memset(hit_distance_rows[row], RGB_MATRIX_HIT_DISTANCE_UNKNOWN, RGB_MATRIX_LED_COUNT);
+    return hit_distance_rows[row];
+}
+
+void rgb_matrix_hit_distance_cache_clear(void) {
+    memset(hit_distance_origin, NO_LED, sizeof(hit_distance_origin));
+}
+#endif // RGB_MATRIX_HIT_DISTANCE_CACHE
 
 // internals
 static bool            suspend_state     = false;
@@ -80,7 +115,18 @@ static rgb_task_states rgb_task_state    = SYNCING;
 // double buffers
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-static last_hit_t last_hit_buffer;
+// Ring buffer of recent hits, oldest first. Hits are stamped with the time they happened, so ticks are derived when
+// the frame snapshot is taken instead of every entry being aged on every task run.
+static struct {
+    uint8_t  head;
+    uint8_t  count;
+    uint8_t  index[LED_HITS_TO_REMEMBER];
+    uint32_t time[LED_HITS_TO_REMEMBER];
+} last_hit_buffer;
+
+static inline uint8_t last_hit_next(uint8_t pos) {
+    return ++pos == LED_HITS_TO_REMEMBER ? 0 : pos;
+}
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 // split rgb matrix
@@ -183,21 +229,18 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         led_count = rgb_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
+    uint32_t now = sync_timer_read32();
     for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
-        last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
-        last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
-        last_hit_buffer.index[index] = led[i];
-        last_hit_buffer.tick[index]  = 0;
-        last_hit_buffer.count++;
+        uint8_t slot = last_hit_buffer.head + last_hit_buffer.count;
+        if (slot >= LED_HITS_TO_REMEMBER) slot -= LED_HITS_TO_REMEMBER;
+        if (last_hit_buffer.count == LED_HITS_TO_REMEMBER) {
+            // Full: overwrite the oldest hit
+            last_hit_buffer.head = last_hit_next(last_hit_buffer.head);
+        } else {
+            last_hit_buffer.count++;
+        }
+        last_hit_buffer.index[slot] = led[i];
+        last_hit_buffer.time[slot]  = now;
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
@@ -249,23 +292,36 @@ static bool rgb_matrix_none(effect_params_t *params) {
 }
 
 static void rgb_task_timers(void) {
-#if defined(RGB_MATRIX_KEYREACTIVE_ENABLED)
-    uint32_t deltaTime = sync_timer_elapsed32(rgb_timer_buffer);
-#endif // defined(RGB_MATRIX_KEYREACTIVE_ENABLED)
     rgb_timer_buffer = sync_timer_read32();
+}
 
-    // Update double buffer last hit timers
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    uint8_t count = last_hit_buffer.count;
-    for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
+static void rgb_task_last_hits(void) {
+    uint8_t pos   = last_hit_buffer.head;
+    uint8_t count = 0;
+    for (uint8_t i = last_hit_buffer.count; i > 0; i--) {
+        uint32_t age = TIMER_DIFF_32(rgb_timer_buffer, last_hit_buffer.time[pos]);
+        if ((int32_t)age < 0) {
+            age = 0;
+        } else if (age >= UINT16_MAX) {
+            // Only the oldest hits can have expired, so dropping them from the front keeps the ring contiguous
+            last_hit_buffer.head = last_hit_next(pos);
             last_hit_buffer.count--;
+            pos = last_hit_buffer.head;
             continue;
         }
-        last_hit_buffer.tick[i] += deltaTime;
+
+        uint8_t led                     = last_hit_buffer.index[pos];
+        g_last_hit_tracker.x[count]     = g_led_config.point[led].x;
+        g_last_hit_tracker.y[count]     = g_led_config.point[led].y;
+        g_last_hit_tracker.index[count] = led;
+        g_last_hit_tracker.tick[count]  = age;
+        count++;
+        pos = last_hit_next(pos);
     }
-#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+    g_last_hit_tracker.count = count;
 }
+#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 static void rgb_task_sync(void) {
     eeconfig_flush_rgb_matrix(false);
@@ -280,7 +336,7 @@ static void rgb_task_start(void) {
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker = last_hit_buffer;
+    rgb_task_last_hits();
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
     // next task
@@ -461,11 +517,12 @@ void rgb_matrix_init(void) {
         g_last_hit_tracker.tick[i] = UINT16_MAX;
     }
 
+    last_hit_buffer.head  = 0;
     last_hit_buffer.count = 0;
-    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
-        last_hit_buffer.tick[i] = UINT16_MAX;
-    }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_HIT_DISTANCE_CACHE
+    rgb_matrix_hit_distance_cache_clear();
+#endif // RGB_MATRIX_HIT_DISTANCE_CACHE
 
     eeconfig_init_rgb_matrix();
     if (!rgb_matrix_config.mode) {
@@ -277,6 +277,14 @@ extern led_config_t g_led_config;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
+#ifdef RGB_MATRIX_HIT_DISTANCE_CACHE
+/* Returns the cached distances from the LED at `origin` to every LED, indexed by LED. Entries that have not been
+ * calculated yet read as RGB_MATRIX_HIT_DISTANCE_UNKNOWN, and the caller fills them in. `origin` must be the index of a
+ * hit in g_last_hit_tracker, as rows belonging to the other remembered hits are never recycled. */
+uint8_t *rgb_matrix_hit_distances(uint8_t origin);
+/* Drops all cached distances. Needed if g_led_config positions are changed at runtime. */
+void rgb_matrix_hit_distance_cache_clear(void);
+#endif
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
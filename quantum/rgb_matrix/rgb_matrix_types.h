@@ -16,6 +16,10 @@
 
 #pragma once
 
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
 #include <stdint.h>
 #include <stdbool.h>
 #include "color.h"
@@ -25,6 +29,11 @@
 #    define RGB_MATRIX_KEYREACTIVE_ENABLED
 #endif
 
+// The distance cache only serves reactive effects
+#if defined(RGB_MATRIX_HIT_DISTANCE_CACHE) && !defined(RGB_MATRIX_KEYREACTIVE_ENABLED)
+#    undef RGB_MATRIX_HIT_DISTANCE_CACHE
+#endif
+
 // Last led hit
 #ifndef LED_HITS_TO_REMEMBER
 #    define LED_HITS_TO_REMEMBER 8
@@ -40,6 +49,10 @@ typedef struct PACKED {
 } last_hit_t;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+// Marks a distance that has not been calculated yet. LED coordinates are normally at most {224, 64}, so real distances
+// stay below it; any that do reach it are simply recalculated every frame.
+#define RGB_MATRIX_HIT_DISTANCE_UNKNOWN 255
+
 typedef enum rgb_task_states { STARTING, RENDERING, FLUSHING, SYNCING } rgb_task_states;
 
 typedef uint8_t led_flags_t;
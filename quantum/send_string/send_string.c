@@ -326,3 +326,217 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
     send_string_with_delay_impl(send_string_get_next_progmem, &state, interval);
 }
 #endif
+
+#ifdef SENDSTRING_ASYNC
+#    include <string.h>
+#    include "timer.h"
+#    ifdef IDLE_SCHEDULER_ENABLE
+#        include "idle_scheduler.h"
+#    endif
+
+// The longest expansion of a single character: shift, AltGr, key, and a dead key space
+#    define SENDSTRING_ASYNC_MAX_STEPS 8
+
+typedef struct send_string_async_job_t {
+    char (*getter)(void *);
+    union {
+        void *  align;
+        uint8_t bytes[SENDSTRING_ASYNC_STATE_SIZE];
+    } state;
+    uint8_t interval;
+} send_string_async_job_t;
+
+static send_string_async_job_t async_jobs[SENDSTRING_ASYNC_QUEUE_SIZE];
+static uint8_t                 async_job_head  = 0;
+static uint8_t                 async_job_count = 0;
+
+// Key events still to be sent for the character or escape sequence currently being typed
+static uint8_t  async_step_keycodes[SENDSTRING_ASYNC_MAX_STEPS];
+static uint8_t  async_step_pressed = 0;
+static uint8_t  async_step_count   = 0;
+static uint8_t  async_step_index   = 0;
+static uint32_t async_next_step    = 0;
+
+// Keys currently held down by the queue, including those left down by SS_DOWN() in an earlier step
+static uint8_t async_held_keys[32];
+
+static void async_push_step(uint8_t keycode, bool pressed) {
+    if (pressed) {
+        async_step_pressed |= (1 << async_step_count);
+    } else {
+        async_step_pressed &= ~(1 << async_step_count);
+    }
+    async_step_keycodes[async_step_count++] = keycode;
+}
+
+static void async_push_char(char ascii_code) {
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') { // BEL
+        PLAY_SONG(bell_song);
+        return;
+    }
+#    endif
+
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+    if (is_shifted) async_push_step(KC_LEFT_SHIFT, true);
+    if (is_altgred) async_push_step(KC_RIGHT_ALT, true);
+    async_push_step(keycode, true);
+    async_push_step(keycode, false);
+    if (is_altgred) async_push_step(KC_RIGHT_ALT, false);
+    if (is_shifted) async_push_step(KC_LEFT_SHIFT, false);
+    if (is_dead) {
+        async_push_step(KC_SPACE, true);
+        async_push_step(KC_SPACE, false);
+    }
+}
+
+static void async_pop_job(void) {
+    async_job_head = (async_job_head + 1) % SENDSTRING_ASYNC_QUEUE_SIZE;
+    async_job_count--;
+}
+
+// Decodes the next character or escape sequence of the current job into key events, or pushes back the next step
+// for SS_DELAY(). Returns false once the current job has been exhausted.
+static bool async_decode_next(uint32_t now) {
+    send_string_async_job_t *job = &async_jobs[async_job_head];
+
+    async_step_count = 0;
+    async_step_index = 0;
+
+    char ascii_code = job->getter(&job->state);
+    if (!ascii_code) return false;
+    if (ascii_code != SS_QMK_PREFIX) {
+        async_push_char(ascii_code);
+        return true;
+    }
+
+    ascii_code = job->getter(&job->state);
+    if (ascii_code == SS_TAP_CODE) {
+        uint8_t keycode = job->getter(&job->state);
+        async_push_step(keycode, true);
+        async_push_step(keycode, false);
+    } else if (ascii_code == SS_DOWN_CODE) {
+        async_push_step(job->getter(&job->state), true);
+    } else if (ascii_code == SS_UP_CODE) {
+        async_push_step(job->getter(&job->state), false);
+    } else if (ascii_code == SS_DELAY_CODE) {
+        uint32_t ms = 0;
+        ascii_code  = job->getter(&job->state);
+        while (isdigit(ascii_code)) {
+            ms *= 10;
+            ms += ascii_code - '0';
+            ascii_code = job->getter(&job->state);
+        }
+        async_next_step = now + ms;
+        // if we had a delay that terminated with a null, we're done
+        return ascii_code != 0;
+    }
+    return ascii_code != 0;
+}
+
+bool send_string_async_impl(char (*getter)(void *), const void *state, uint8_t state_size, uint8_t interval) {
+    if (async_job_count >= SENDSTRING_ASYNC_QUEUE_SIZE || state_size > SENDSTRING_ASYNC_STATE_SIZE) {
+        return false;
+    }
+
+    send_string_async_job_t *job = &async_jobs[(async_job_head + async_job_count) % SENDSTRING_ASYNC_QUEUE_SIZE];
+    job->getter                  = getter;
+    job->interval                = interval;
+    memcpy(job->state.bytes, state, state_size);
+
+    if (async_job_count++ == 0) {
+        async_next_step = timer_read32();
+    }
+#    ifdef IDLE_SCHEDULER_ENABLE
+    idle_scheduler_keep_awake();
+#    endif
+    return true;
+}
+
+bool send_string_async_with_delay(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    return send_string_async_impl(send_string_get_next_ram, &state, sizeof(state), interval);
+}
+
+bool send_string_async(const char *string) {
+    return send_string_async_with_delay(string, TAP_CODE_DELAY);
+}
+
+#    if defined(__AVR__)
+bool send_string_async_with_delay_P(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    return send_string_async_impl(send_string_get_next_progmem, &state, sizeof(state), interval);
+}
+#    endif
+
+bool send_string_async_busy(void) {
+    return async_job_count > 0;
+}
+
+void send_string_async_cancel(void) {
+    // Release everything the queue pressed, so that cancelling never leaves keys or modifiers stuck down
+    for (uint16_t keycode = 0; keycode <= UINT8_MAX; keycode++) {
+        if (async_held_keys[keycode / 8] & (1 << (keycode % 8))) {
+            unregister_code(keycode);
+        }
+    }
+    memset(async_held_keys, 0, sizeof(async_held_keys));
+    async_step_count = 0;
+    async_step_index = 0;
+    async_job_head   = 0;
+    async_job_count  = 0;
+}
+
+void send_string_async_task(void) {
+    if (async_job_count == 0) {
+        return;
+    }
+
+    uint32_t now = timer_read32();
+    if (!timer_expired32(now, async_next_step)) {
+#    ifdef IDLE_SCHEDULER_ENABLE
+        idle_scheduler_request_wakeup(async_next_step);
+#    endif
+        return;
+    }
+
+    while (async_step_index >= async_step_count) {
+        if (!async_decode_next(now)) {
+            async_step_count = 0;
+            async_step_index = 0;
+            async_pop_job();
+            if (async_job_count == 0) {
+                return;
+            }
+        }
+        // SS_DELAY() pushes the next step out without producing any key events
+        if (!timer_expired32(now, async_next_step)) {
+#    ifdef IDLE_SCHEDULER_ENABLE
+            idle_scheduler_request_wakeup(async_next_step);
+#    endif
+            return;
+        }
+    }
+
+    // At most one report per main loop iteration, and never more than one per millisecond
+    uint8_t keycode = async_step_keycodes[async_step_index];
+    if (async_step_pressed & (1 << async_step_index)) {
+        register_code(keycode);
+        async_held_keys[keycode / 8] |= (1 << (keycode % 8));
+    } else {
+        unregister_code(keycode);
+        async_held_keys[keycode / 8] &= ~(1 << (keycode % 8));
+    }
+    async_step_index++;
+
+    uint8_t interval = async_jobs[async_job_head].interval;
+    async_next_step  = now + (interval ? interval : 1);
+#    ifdef IDLE_SCHEDULER_ENABLE
+    idle_scheduler_request_wakeup(async_next_step);
+#    endif
+}
+#endif
@@ -23,6 +23,7 @@
  * \{
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "progmem.h"
@@ -169,4 +170,84 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval);
 
+#if defined(SENDSTRING_ASYNC) || defined(__DOXYGEN__)
+/**
+ * \brief The number of strings that can be queued for asynchronous sending at once.
+ */
+#    ifndef SENDSTRING_ASYNC_QUEUE_SIZE
+#        define SENDSTRING_ASYNC_QUEUE_SIZE 4
+#    endif
+
+/**
+ * \brief The maximum size, in bytes, of the getter state stored alongside each queued string.
+ */
+#    ifndef SENDSTRING_ASYNC_STATE_SIZE
+#        define SENDSTRING_ASYNC_STATE_SIZE sizeof(void *)
+#    endif
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out without blocking.
+ * This function simply calls `send_string_async_with_delay(string, TAP_CODE_DELAY)`.
+ * The string is read as it is typed, so it must stay valid until sending has finished -- string literals are always safe.
+ * \param string The string to type out.
+ * \return true if the string was queued, false if the queue is full.
+ */
+bool send_string_async(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out without blocking, with a delay between each key event.
+ * Key events are sent one per main loop iteration, and never more than one per millisecond, so matrix scanning and other tasks keep running in between.
+ * \param string The string to type out. Must stay valid until sending has finished.
+ * \param interval The amount of time, in milliseconds, to wait between key events.
+ * \return true if the string was queued, false if the queue is full.
+ */
+bool send_string_async_with_delay(const char *string, uint8_t interval);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out without blocking, with a delay between each key event.
+ * On ARM devices, this function is simply an alias for send_string_async_with_delay(string, interval).
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait between key events.
+ * \return true if the string was queued, false if the queue is full.
+ */
+bool send_string_async_with_delay_P(const char *string, uint8_t interval);
+#    else
+#        define send_string_async_with_delay_P(string, interval) send_string_async_with_delay(string, interval)
+#    endif
+
+/**
+ * \brief Shortcut macro for send_string_async_with_delay_P(PSTR(string), 0).
+ */
+#    define SEND_STRING_ASYNC(string) send_string_async_with_delay_P(PSTR(string), 0)
+
+/**
+ * \brief Check whether any queued strings are still being typed out.
+ * \return true if the queue is not empty.
+ */
+bool send_string_async_busy(void);
+
+/**
+ * \brief Abandon the string being typed and everything queued behind it.
+ * Any keys the queue is still holding down, such as Shift or keys pressed with SS_DOWN(), are released before returning.
+ */
+void send_string_async_cancel(void);
+
+/**
+ * \brief Asynchronous equivalent of `send_string_with_delay_impl()`.
+ * The getter state is copied into the queue, and `getter` is invoked with a pointer to that copy.
+ * \param getter The function returning the next byte of the string.
+ * \param state The initial getter state.
+ * \param state_size The size of the getter state, at most `SENDSTRING_ASYNC_STATE_SIZE`.
+ * \param interval The amount of time, in milliseconds, to wait between key events.
+ * \return true if the string was queued, false if the queue is full.
+ */
+bool send_string_async_impl(char (*getter)(void *), const void *state, uint8_t state_size, uint8_t interval);
+
+/**
+ * \brief Forward declaration for the main loop in order to send the next queued key event. Should not be invoked by keyboard/user code.
+ */
+void send_string_async_task(void);
+#endif
+
 /** \} */
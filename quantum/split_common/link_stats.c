@@ -0,0 +1,169 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef SPLIT_LINK_STATS_ENABLE
+
+#    include <string.h>
+#    include "link_stats.h"
+#    include "print.h"
+#    include "timer.h"
+
+static split_link_stats_t stats[NUM_TOTAL_TRANSACTIONS];
+static uint16_t           histogram[SPLIT_LINK_STATS_HISTOGRAM_BUCKETS];
+
+static uint16_t window_transactions = 0;
+static uint16_t window_errors       = 0;
+static uint8_t  window_attempts     = 1; // highest attempt that a handler needed in this window
+static bool     window_exhausted    = false;
+static uint8_t  attempts            = SPLIT_LINK_ATTEMPTS_MAX;
+
+#    ifdef SPLIT_LINK_ADAPTIVE_SPEED
+static uint8_t speed_step    = 0;
+static uint8_t clean_windows = 0;
+#    endif
+
+__attribute__((weak)) uint32_t split_link_stats_timestamp(void) {
+    return timer_read32();
+}
+
+void split_link_stats_clear(void) {
+    memset(stats, 0, sizeof(stats));
+    memset(histogram, 0, sizeof(histogram));
+    window_transactions = 0;
+    window_errors       = 0;
+    window_attempts     = 1;
+    window_exhausted    = false;
+    attempts            = SPLIT_LINK_ATTEMPTS_MAX;
+#    ifdef SPLIT_LINK_ADAPTIVE_SPEED
+    speed_step    = 0;
+    clean_windows = 0;
+#    endif
+}
+
+//------------------------------------
+// Policies
+//
+
+static void evaluate_window(void) {
+    // A handler that ran out of attempts might have made it with more; otherwise allow one more than was needed
+    if (window_exhausted || window_attempts >= SPLIT_LINK_ATTEMPTS_MAX) {
+        attempts = SPLIT_LINK_ATTEMPTS_MAX;
+    } else if (window_attempts + 1 < SPLIT_LINK_ATTEMPTS_MIN) {
+        attempts = SPLIT_LINK_ATTEMPTS_MIN;
+    } else {
+        attempts = window_attempts + 1;
+    }
+
+#    ifdef SPLIT_LINK_ADAPTIVE_SPEED
+    if ((uint32_t)window_errors * 1000 > (uint32_t)SPLIT_LINK_SPEED_DOWN_PERMILLE * window_transactions) {
+        if (speed_step < SPLIT_LINK_SPEED_STEPS) {
+            speed_step++;
+        }
+        clean_windows = 0;
+    } else if (window_errors) {
+        clean_windows = 0;
+    } else if (++clean_windows >= SPLIT_LINK_SPEED_UP_WINDOWS) {
+        if (speed_step) {
+            speed_step--;
+        }
+        clean_windows = 0;
+    }
+#    endif
+
+    window_transactions = 0;
+    window_errors       = 0;
+    window_attempts     = 1;
+    window_exhausted    = false;
+}
+
+uint8_t split_link_attempts(void) {
+    return attempts;
+}
+
+#    ifdef SPLIT_LINK_ADAPTIVE_SPEED
+uint8_t split_link_speed_step(void) {
+    return speed_step;
+}
+
+void split_link_speed_reset(void) {
+    speed_step    = 0;
+    clean_windows = 0;
+}
+#    endif
+
+//------------------------------------
+// Recording
+//
+
+void split_link_stats_record(int8_t transaction_id, bool okay, uint32_t rtt) {
+    split_link_stats_t *entry = &stats[transaction_id];
+    entry->attempts++;
+    if (okay) {
+        entry->rtt_total += rtt;
+        if (rtt > entry->rtt_max) {
+            entry->rtt_max = rtt;
+        }
+
+        uint8_t bucket = 0;
+        while (rtt && bucket < SPLIT_LINK_STATS_HISTOGRAM_BUCKETS - 1) {
+            rtt >>= 1;
+            bucket++;
+        }
+        if (histogram[bucket] < UINT16_MAX) {
+            histogram[bucket]++;
+        }
+    } else {
+        entry->failures++;
+        window_errors++;
+    }
+
+    if (++window_transactions >= SPLIT_LINK_STATS_WINDOW) {
+        evaluate_window();
+    }
+}
+
+void split_link_stats_checksum_error(int8_t transaction_id) {
+    stats[transaction_id].checksum_errors++;
+    window_errors++;
+}
+
+void split_link_stats_handler_result(uint8_t attempt, bool okay) {
+    if (!okay) {
+        window_exhausted = true;
+    } else if (attempt > window_attempts) {
+        window_attempts = attempt;
+    }
+}
+
+//------------------------------------
+// Readout
+//
+
+const split_link_stats_t *split_link_stats_get(int8_t transaction_id) {
+    return &stats[transaction_id];
+}
+
+const uint16_t *split_link_stats_histogram(void) {
+    return histogram;
+}
+
+void split_link_stats_print(void) {
+#    ifdef CONSOLE_ENABLE
+    for (uint8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        const split_link_stats_t *entry = &stats[id];
+        if (entry->attempts) {
+            uprintf("%2u: %lu attempts, %lu failed, %lu bad checksum, rtt max %lu\n", id, (unsigned long)entry->attempts, (unsigned long)entry->failures, (unsigned long)entry->checksum_errors, (unsigned long)entry->rtt_max);
+        }
+    }
+    uprintf("rtt");
+    for (uint8_t bucket = 0; bucket < SPLIT_LINK_STATS_HISTOGRAM_BUCKETS; bucket++) {
+        uprintf(" %u", histogram[bucket]);
+    }
+    uprintf("\nattempts %u\n", attempts);
+#        ifdef SPLIT_LINK_ADAPTIVE_SPEED
+    uprintf("speed step %u\n", speed_step);
+#        endif
+#    endif
+}
+
+#endif // SPLIT_LINK_STATS_ENABLE
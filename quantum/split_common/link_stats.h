@@ -0,0 +1,132 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "transaction_id_define.h"
+
+/**
+ * @def The number of transactions after which the retry and speed policies are re-evaluated.
+ */
+#ifndef SPLIT_LINK_STATS_WINDOW
+#    define SPLIT_LINK_STATS_WINDOW 128
+#endif
+
+/**
+ * @def The number of logarithmic round-trip time histogram buckets. Bucket 0 counts zero-length round trips, bucket N
+ *      counts [2^(N-1), 2^N) timestamp units, and the last bucket also counts everything longer.
+ */
+#ifndef SPLIT_LINK_STATS_HISTOGRAM_BUCKETS
+#    define SPLIT_LINK_STATS_HISTOGRAM_BUCKETS 12
+#endif
+
+/**
+ * @def Bounds for the number of attempts a transaction handler makes before the scan gives up on it.
+ */
+#ifndef SPLIT_LINK_ATTEMPTS_MIN
+#    define SPLIT_LINK_ATTEMPTS_MIN 2
+#endif
+#ifndef SPLIT_LINK_ATTEMPTS_MAX
+#    define SPLIT_LINK_ATTEMPTS_MAX 10
+#endif
+
+#ifdef SPLIT_LINK_ADAPTIVE_SPEED
+/**
+ * @def How many times the link speed may be halved from the configured speed.
+ */
+#    ifndef SPLIT_LINK_SPEED_STEPS
+#        define SPLIT_LINK_SPEED_STEPS 3
+#    endif
+
+/**
+ * @def Errors per thousand transactions in a window above which the link speed is halved.
+ */
+#    ifndef SPLIT_LINK_SPEED_DOWN_PERMILLE
+#        define SPLIT_LINK_SPEED_DOWN_PERMILLE 10
+#    endif
+
+/**
+ * @def The number of consecutive error-free windows after which the link speed is doubled again.
+ */
+#    ifndef SPLIT_LINK_SPEED_UP_WINDOWS
+#        define SPLIT_LINK_SPEED_UP_WINDOWS 8
+#    endif
+
+/**
+ * @def Milliseconds without hearing from the master after which the slave falls back to the configured speed.
+ */
+#    ifndef SPLIT_LINK_SPEED_TIMEOUT
+#        define SPLIT_LINK_SPEED_TIMEOUT 250
+#    endif
+#endif // SPLIT_LINK_ADAPTIVE_SPEED
+
+typedef struct split_link_stats_t {
+    uint32_t attempts;
+    uint32_t failures;        // the transport reported an error, e.g. a timeout or a bad handshake
+    uint32_t checksum_errors; // the transaction completed but its payload did not match its checksum
+    uint32_t rtt_total;       // sum of round-trip times of successful transactions, in timestamp units
+    uint32_t rtt_max;
+} split_link_stats_t;
+
+/**
+ * Returns the current timestamp used for round-trip times. Defaults to `timer_read32()`, boards can override it with
+ * a finer grained counter.
+ */
+uint32_t split_link_stats_timestamp(void);
+
+/**
+ * Records the outcome of one transport transaction.
+ */
+void split_link_stats_record(int8_t transaction_id, bool okay, uint32_t rtt);
+
+/**
+ * Records a transaction whose payload failed its checksum.
+ */
+void split_link_stats_checksum_error(int8_t transaction_id);
+
+/**
+ * Records the outcome of a transaction handler.
+ *
+ * @param attempt[in] the attempt that succeeded, or the last one made
+ * @param okay[in] whether any attempt succeeded
+ */
+void split_link_stats_handler_result(uint8_t attempt, bool okay);
+
+/**
+ * @return the counters of a transaction ID, suitable for copying into a raw HID response
+ */
+const split_link_stats_t *split_link_stats_get(int8_t transaction_id);
+
+/**
+ * @return an array of `SPLIT_LINK_STATS_HISTOGRAM_BUCKETS` saturating round-trip time counters over all transactions
+ */
+const uint16_t *split_link_stats_histogram(void);
+
+/**
+ * @return the number of attempts a transaction handler should make, tuned from the attempts recent transactions needed
+ */
+uint8_t split_link_attempts(void);
+
+#ifdef SPLIT_LINK_ADAPTIVE_SPEED
+/**
+ * @return how many times the link speed should be halved from the configured speed
+ */
+uint8_t split_link_speed_step(void);
+
+/**
+ * Returns the link to the configured speed, e.g. after the slave was lost.
+ */
+void split_link_speed_reset(void);
+#endif // SPLIT_LINK_ADAPTIVE_SPEED
+
+/**
+ * Discards all counters and restarts the retry and speed policies.
+ */
+void split_link_stats_clear(void);
+
+/**
+ * Prints the counters and histogram to the console.
+ */
+void split_link_stats_print(void);
@@ -0,0 +1,145 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "mock.h"
+#include "transactions.h"
+#include "serial.h"
+#include "action_layer.h"
+
+#define split_shmem_offset_ptr_of(memory, offset) (((uint8_t *)(memory)) + (offset))
+
+static split_shared_memory_t slave_memory;
+
+static uint16_t transaction_count[NUM_TOTAL_TRANSACTIONS];
+static uint8_t  fail_count    = 0;
+static uint8_t  corrupt_count = 0;
+static bool     in_slave      = false;
+static uint8_t  speed_step[2] = {0, 0}; // master, slave
+
+layer_state_t layer_state         = 0;
+layer_state_t default_layer_state = 0;
+
+uint8_t mock_mods      = 0;
+uint8_t mock_weak_mods = 0;
+uint8_t mock_leds      = 0;
+bool    mock_connected = true;
+
+void loopback_reset(void) {
+    memset(split_shmem, 0, sizeof(split_shared_memory_t));
+    memset(&slave_memory, 0, sizeof(slave_memory));
+    memset(transaction_count, 0, sizeof(transaction_count));
+    fail_count          = 0;
+    corrupt_count       = 0;
+    speed_step[0]       = 0;
+    speed_step[1]       = 0;
+    mock_connected      = true;
+    layer_state         = 0;
+    default_layer_state = 0;
+    mock_mods           = 0;
+    mock_weak_mods      = 0;
+    mock_leds           = 0;
+}
+
+split_shared_memory_t *loopback_slave_memory(void) {
+    return &slave_memory;
+}
+
+uint16_t loopback_transactions(int8_t id) {
+    return transaction_count[id];
+}
+
+void loopback_fail_next(uint8_t count) {
+    fail_count = count;
+}
+
+void loopback_corrupt_next(uint8_t count) {
+    corrupt_count = count;
+}
+
+uint8_t loopback_speed_step(bool slave) {
+    return speed_step[slave];
+}
+
+void loopback_run_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_shared_memory_t master_memory;
+    memcpy(&master_memory, split_shmem, sizeof(master_memory));
+    memcpy(split_shmem, &slave_memory, sizeof(slave_memory));
+    in_slave = true;
+    transactions_slave(master_matrix, slave_matrix);
+#ifdef SPLIT_LINK_ADAPTIVE_SPEED
+    // The transport thread also wakes up when nothing arrives for a while
+    transactions_slave_link_speed_task();
+#endif
+    in_slave = false;
+    memcpy(&slave_memory, split_shmem, sizeof(slave_memory));
+    memcpy(split_shmem, &master_memory, sizeof(master_memory));
+}
+
+void serial_transport_driver_set_speed_step(uint8_t step) {
+    speed_step[in_slave] = step;
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+bool soft_serial_transaction(int index) {
+    split_transaction_desc_t *trans = &split_transaction_table[index];
+    transaction_count[index]++;
+
+    if (fail_count) {
+        fail_count--;
+        return false;
+    }
+    if (speed_step[0] != speed_step[1]) {
+        return false;
+    }
+
+    // Send the initiator buffer across, then run the slave side against its own memory
+    split_shared_memory_t master_memory;
+    memcpy(&master_memory, split_shmem, sizeof(master_memory));
+    memcpy(split_shmem, &slave_memory, sizeof(slave_memory));
+    memcpy(split_trans_initiator2target_buffer(trans), split_shmem_offset_ptr_of(&master_memory, trans->initiator2target_offset), trans->initiator2target_buffer_size);
+    if (corrupt_count && trans->initiator2target_buffer_size) {
+        corrupt_count--;
+        split_trans_initiator2target_buffer(trans)[0] ^= 0x5A;
+    }
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+    memcpy(&slave_memory, split_shmem, sizeof(slave_memory));
+#ifdef SPLIT_LINK_ADAPTIVE_SPEED
+    // The slave transport thread runs this once the transaction is over
+    in_slave = true;
+    transactions_slave_link_speed_task();
+    in_slave = false;
+#endif
+
+    // Bring the target buffer back
+    memcpy(split_shmem, &master_memory, sizeof(master_memory));
+    memcpy(split_trans_target2initiator_buffer(trans), split_shmem_offset_ptr_of(&slave_memory, trans->target2initiator_offset), trans->target2initiator_buffer_size);
+    return true;
+}
+
+bool is_transport_connected(void) {
+    return mock_connected;
+}
+
+uint8_t host_keyboard_leds(void) {
+    return mock_leds;
+}
+
+void set_split_host_keyboard_leds(uint8_t led_state) {}
+
+uint8_t get_mods(void) {
+    return mock_mods;
+}
+
+uint8_t get_weak_mods(void) {
+    return mock_weak_mods;
+}
+
+void set_mods(uint8_t mods) {}
+
+void set_weak_mods(uint8_t mods) {}
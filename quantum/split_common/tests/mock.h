@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "transport.h"
+
+/**
+ * Loopback serial driver: the master half uses `split_shmem`, the slave half has its own copy of the shared memory
+ * that is only swapped in while a slave callback runs, and whole buffers are copied across the way a serial link does.
+ */
+void                   loopback_reset(void);
+split_shared_memory_t *loopback_slave_memory(void);
+uint16_t               loopback_transactions(int8_t id);
+void                   loopback_fail_next(uint8_t count);
+void                   loopback_corrupt_next(uint8_t count);
+void                   loopback_run_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+uint8_t                loopback_speed_step(bool slave);
+
+extern uint8_t mock_mods;
+extern uint8_t mock_weak_mods;
+extern uint8_t mock_leds;
+extern bool    mock_connected;
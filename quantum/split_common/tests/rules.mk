@@ -0,0 +1,39 @@
+transactions_batched_DEFS := -DSPLIT_KEYBOARD -DSPLIT_TRANSACTION_BATCHING -DSPLIT_TRANSACTION_BATCH_DELTAS
+transactions_batched_INC := $(QUANTUM_PATH)/split_common $(DRIVER_PATH)
+transactions_batched_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock.h
+
+transactions_batched_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/tests/mock.c \
+	$(QUANTUM_PATH)/split_common/tests/transactions_tests.cpp
+
+transactions_single_read_DEFS := -DSPLIT_KEYBOARD -DSPLIT_TRANSPORT_MATRIX_SINGLE_READ
+transactions_single_read_INC := $(QUANTUM_PATH)/split_common $(DRIVER_PATH)
+transactions_single_read_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock.h
+
+transactions_single_read_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/tests/mock.c \
+	$(QUANTUM_PATH)/split_common/tests/transactions_single_read_tests.cpp
+
+transactions_link_stats_DEFS := -DSPLIT_KEYBOARD -DSPLIT_LINK_STATS_ENABLE -DSPLIT_LINK_ADAPTIVE_SPEED -DSERIAL_DRIVER_USART
+transactions_link_stats_INC := $(QUANTUM_PATH)/split_common $(DRIVER_PATH) $(PLATFORM_PATH)/chibios/drivers
+transactions_link_stats_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock.h
+
+transactions_link_stats_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/link_stats.c \
+	$(QUANTUM_PATH)/split_common/tests/mock.c \
+	$(QUANTUM_PATH)/split_common/tests/transactions_link_stats_tests.cpp
@@ -0,0 +1,4 @@
+TEST_LIST += \
+	transactions_batched \
+	transactions_link_stats \
+	transactions_single_read
@@ -0,0 +1,116 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+// The transaction IDs are checked with the C spelling of static_assert
+#define _Static_assert static_assert
+
+extern "C" {
+#include "crc.h"
+#include "timer.h"
+#include "transactions.h"
+#include "link_stats.h"
+#include "split_common/tests/mock.h"
+
+void advance_time(uint32_t ms);
+
+static uint32_t timestamp = 0;
+
+uint32_t split_link_stats_timestamp(void) {
+    // Every transaction takes three units
+    uint32_t now = timestamp;
+    timestamp += 3;
+    return now;
+}
+}
+
+class LinkStats : public ::testing::Test {
+   protected:
+    matrix_row_t master_matrix[MATRIX_ROWS / 2] = {0};
+    matrix_row_t slave_matrix[MATRIX_ROWS / 2]  = {0};
+
+    void SetUp() override {
+        loopback_reset();
+        set_slave_matrix(0, 0);
+        timestamp = 0;
+        split_link_stats_clear();
+    }
+
+    bool run_master() {
+        return transactions_master(master_matrix, slave_matrix);
+    }
+
+    void set_slave_matrix(matrix_row_t row0, matrix_row_t row1) {
+        split_shared_memory_t *slave = loopback_slave_memory();
+        slave->smatrix.matrix[0]     = row0;
+        slave->smatrix.matrix[1]     = row1;
+        slave->smatrix.checksum      = crc8(slave->smatrix.matrix, sizeof(slave->smatrix.matrix));
+    }
+
+    /* Idle scans make exactly one transaction each, the slave matrix checksum poll. */
+    void run_idle_scans(uint16_t count) {
+        for (uint16_t i = 0; i < count; i++) {
+            EXPECT_TRUE(run_master());
+        }
+    }
+};
+
+TEST_F(LinkStats, CountsFailuresChecksumErrorsAndRoundTrips) {
+    loopback_fail_next(1);
+    EXPECT_TRUE(run_master());
+
+    const split_link_stats_t *poll = split_link_stats_get(GET_SLAVE_MATRIX_CHECKSUM);
+    EXPECT_EQ(poll->attempts, 2);
+    EXPECT_EQ(poll->failures, 1);
+    EXPECT_EQ(poll->rtt_total, 3);
+    EXPECT_EQ(poll->rtt_max, 3);
+    EXPECT_EQ(split_link_stats_histogram()[2], 1);
+
+    // A corrupted slave checksum fails every attempt at the data read
+    set_slave_matrix(0x01, 0x00);
+    loopback_slave_memory()->smatrix.checksum ^= 0xFF;
+    EXPECT_FALSE(run_master());
+    EXPECT_EQ(split_link_stats_get(GET_SLAVE_MATRIX_DATA)->checksum_errors, SPLIT_LINK_ATTEMPTS_MAX);
+    EXPECT_EQ(split_link_stats_get(GET_SLAVE_MATRIX_DATA)->failures, 0);
+}
+
+TEST_F(LinkStats, AttemptsFollowWhatTransactionsNeeded) {
+    EXPECT_EQ(split_link_attempts(), SPLIT_LINK_ATTEMPTS_MAX);
+
+    run_idle_scans(SPLIT_LINK_STATS_WINDOW);
+    EXPECT_EQ(split_link_attempts(), SPLIT_LINK_ATTEMPTS_MIN);
+
+    // One retry was needed, so allow one more than that
+    loopback_fail_next(1);
+    run_idle_scans(SPLIT_LINK_STATS_WINDOW - 1);
+    EXPECT_EQ(split_link_attempts(), 3);
+
+    // Giving up means more attempts might have helped
+    loopback_fail_next(3);
+    EXPECT_FALSE(run_master());
+    run_idle_scans(SPLIT_LINK_STATS_WINDOW - 3);
+    EXPECT_EQ(split_link_attempts(), SPLIT_LINK_ATTEMPTS_MAX);
+}
+
+TEST_F(LinkStats, SpeedStepsDownAndBothHalvesFallBack) {
+    // 2 errors in 128 transactions is above 1%
+    loopback_fail_next(2);
+    run_idle_scans(SPLIT_LINK_STATS_WINDOW - 2);
+    EXPECT_EQ(split_link_speed_step(), 1);
+
+    // The slave switches right after acknowledging, so both halves move together
+    EXPECT_TRUE(run_master());
+    EXPECT_EQ(loopback_speed_step(false), 1);
+    EXPECT_EQ(loopback_speed_step(true), 1);
+
+    // Losing the master returns the slave to the configured speed, and the master follows once it notices
+    advance_time(SPLIT_LINK_SPEED_TIMEOUT + 1);
+    loopback_run_slave(master_matrix, slave_matrix);
+    EXPECT_EQ(loopback_speed_step(true), 0);
+    EXPECT_FALSE(run_master());
+    mock_connected = false;
+    EXPECT_TRUE(run_master());
+    EXPECT_EQ(loopback_speed_step(false), 0);
+    EXPECT_EQ(split_link_speed_step(), 0);
+}
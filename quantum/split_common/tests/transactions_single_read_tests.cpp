@@ -0,0 +1,49 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+// The transaction IDs are checked with the C spelling of static_assert
+#define _Static_assert static_assert
+
+extern "C" {
+#include "crc.h"
+#include "transactions.h"
+#include "split_common/tests/mock.h"
+}
+
+class SingleReadTransactions : public ::testing::Test {
+   protected:
+    matrix_row_t master_matrix[MATRIX_ROWS / 2] = {0};
+    matrix_row_t slave_matrix[MATRIX_ROWS / 2]  = {0};
+
+    void SetUp() override {
+        loopback_reset();
+    }
+
+    void set_slave_matrix(matrix_row_t row0, matrix_row_t row1) {
+        split_shared_memory_t *slave = loopback_slave_memory();
+        slave->smatrix.matrix[0]     = row0;
+        slave->smatrix.matrix[1]     = row1;
+        slave->smatrix.checksum      = crc8(slave->smatrix.matrix, sizeof(slave->smatrix.matrix));
+    }
+};
+
+TEST_F(SingleReadTransactions, SlaveChangeTakesOneRoundTrip) {
+    set_slave_matrix(0x01, 0x80);
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+
+    EXPECT_EQ(loopback_transactions(GET_SLAVE_MATRIX), 1);
+    EXPECT_EQ(slave_matrix[0], 0x01);
+    EXPECT_EQ(slave_matrix[1], 0x80);
+}
+
+TEST_F(SingleReadTransactions, ChecksumMismatchKeepsLastGoodMatrix) {
+    set_slave_matrix(0x04, 0x00);
+    EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+
+    set_slave_matrix(0x08, 0x00);
+    loopback_slave_memory()->smatrix.checksum ^= 0xFF;
+    EXPECT_FALSE(transactions_master(master_matrix, slave_matrix));
+    EXPECT_EQ(slave_matrix[0], 0x04);
+}
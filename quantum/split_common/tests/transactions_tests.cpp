@@ -0,0 +1,152 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+// The transaction IDs are checked with the C spelling of static_assert
+#define _Static_assert static_assert
+
+extern "C" {
+#include "crc.h"
+#include "action_layer.h"
+#include "transactions.h"
+#include "split_common/tests/mock.h"
+}
+
+class BatchedTransactions : public ::testing::Test {
+   protected:
+    matrix_row_t master_matrix[MATRIX_ROWS / 2] = {0};
+    matrix_row_t slave_matrix[MATRIX_ROWS / 2]  = {0};
+
+    void SetUp() override {
+        loopback_reset();
+        set_slave_matrix(0, 0);
+        // Settle any state left behind by a previous test
+        run_master();
+    }
+
+    bool run_master() {
+        return transactions_master(master_matrix, slave_matrix);
+    }
+
+    void set_slave_matrix(matrix_row_t row0, matrix_row_t row1) {
+        split_shared_memory_t *slave = loopback_slave_memory();
+        slave->smatrix.matrix[0]     = row0;
+        slave->smatrix.matrix[1]     = row1;
+        slave->smatrix.checksum      = crc8(slave->smatrix.matrix, sizeof(slave->smatrix.matrix));
+    }
+};
+
+TEST_F(BatchedTransactions, ChangesShareOneTransaction) {
+    uint16_t batches = loopback_transactions(PUT_BATCH);
+    uint16_t polls   = loopback_transactions(GET_SLAVE_MATRIX_CHECKSUM);
+
+    layer_state = 1 << 3;
+    mock_mods   = 0x02;
+    mock_leds   = 0x01;
+    set_slave_matrix(0x11, 0x22);
+    EXPECT_TRUE(run_master());
+
+    EXPECT_EQ(loopback_transactions(PUT_BATCH), batches + 1);
+    EXPECT_EQ(loopback_transactions(PUT_LAYER_STATE), 0);
+    EXPECT_EQ(loopback_transactions(PUT_MODS), 0);
+    EXPECT_EQ(loopback_transactions(PUT_LED_STATE), 0);
+    EXPECT_EQ(loopback_transactions(GET_SLAVE_MATRIX_CHECKSUM), polls);
+
+    split_shared_memory_t *slave = loopback_slave_memory();
+    EXPECT_EQ(slave->layers.layer_state, 1 << 3);
+    EXPECT_EQ(slave->mods.real_mods, 0x02);
+    EXPECT_EQ(slave->led_state, 0x01);
+    EXPECT_EQ(slave_matrix[0], 0x11);
+    EXPECT_EQ(slave_matrix[1], 0x22);
+}
+
+TEST_F(BatchedTransactions, OnlyChangedBytesAreSent) {
+    layer_state = 1 << 9;
+    EXPECT_TRUE(run_master());
+
+    // One record: layer state, offset 1, one byte
+    EXPECT_EQ(split_shmem->batch.length, 4);
+    EXPECT_EQ(split_shmem->batch.data[0], PUT_LAYER_STATE);
+    EXPECT_EQ(split_shmem->batch.data[1], 1);
+    EXPECT_EQ(split_shmem->batch.data[2], 1);
+    EXPECT_EQ(split_shmem->batch.data[3], 0x02);
+    EXPECT_EQ(loopback_slave_memory()->layers.layer_state, 1 << 9);
+
+    // Nothing changed, so no frame goes out and the slave matrix is polled instead
+    uint16_t batches = loopback_transactions(PUT_BATCH);
+    uint16_t polls   = loopback_transactions(GET_SLAVE_MATRIX_CHECKSUM);
+    EXPECT_TRUE(run_master());
+    EXPECT_EQ(loopback_transactions(PUT_BATCH), batches);
+    EXPECT_EQ(loopback_transactions(GET_SLAVE_MATRIX_CHECKSUM), polls + 1);
+}
+
+TEST_F(BatchedTransactions, IdlePollPicksUpSlaveMatrix) {
+    set_slave_matrix(0x33, 0x44);
+    EXPECT_TRUE(run_master());
+    EXPECT_EQ(slave_matrix[0], 0x33);
+    EXPECT_EQ(slave_matrix[1], 0x44);
+}
+
+TEST_F(BatchedTransactions, CorruptedFrameIsRetransmitted) {
+    uint16_t batches = loopback_transactions(PUT_BATCH);
+
+    mock_weak_mods = 0x20;
+    loopback_corrupt_next(1);
+    EXPECT_TRUE(run_master());
+
+    EXPECT_EQ(loopback_transactions(PUT_BATCH), batches + 2);
+    EXPECT_EQ(loopback_slave_memory()->mods.weak_mods, 0x20);
+}
+
+TEST_F(BatchedTransactions, FailedRecordStaysQueued) {
+    mock_mods = 0x04;
+    loopback_fail_next(10);
+    EXPECT_FALSE(run_master());
+    EXPECT_EQ(loopback_slave_memory()->mods.real_mods, 0x00);
+
+    // The mods were already handed over, so the record left in the frame is what brings them across
+    EXPECT_TRUE(run_master());
+    EXPECT_EQ(loopback_slave_memory()->mods.real_mods, 0x04);
+}
+
+TEST_F(BatchedTransactions, FailedCycleResendsWholeBlocks) {
+    mock_mods = 0x04;
+    loopback_fail_next(10);
+    EXPECT_FALSE(run_master());
+
+    mock_weak_mods = 0x08;
+    EXPECT_TRUE(run_master());
+
+    // The whole block, as the slave may be out of step, replacing the queued delta
+    EXPECT_EQ(split_shmem->batch.length, 3 + sizeof(split_mods_sync_t));
+    EXPECT_EQ(split_shmem->batch.data[0], PUT_MODS);
+    EXPECT_EQ(split_shmem->batch.data[1], 0);
+    EXPECT_EQ(split_shmem->batch.data[2], sizeof(split_mods_sync_t));
+    EXPECT_EQ(loopback_slave_memory()->mods.real_mods, 0x04);
+    EXPECT_EQ(loopback_slave_memory()->mods.weak_mods, 0x08);
+}
+
+TEST_F(BatchedTransactions, UnacknowledgedChangesAreNotQueuedTwice) {
+    layer_state = 1 << 5;
+    mock_mods   = 0x01;
+    loopback_fail_next(UINT8_MAX);
+    for (uint8_t i = 0; i < 3; i++) {
+        EXPECT_FALSE(run_master());
+        mock_mods <<= 1;
+    }
+    loopback_fail_next(0);
+    EXPECT_TRUE(run_master());
+
+    // One record per transaction, whatever the number of scans it waited through
+    const split_batch_sync_t *frame = &split_shmem->batch;
+    bool                      seen[NUM_TOTAL_TRANSACTIONS] = {false};
+    for (uint8_t pos = 0; pos < frame->length; pos += 3 + frame->data[pos + 2]) {
+        EXPECT_FALSE(seen[frame->data[pos]]) << "Transaction " << (int)frame->data[pos] << " was queued twice";
+        seen[frame->data[pos]] = true;
+    }
+    EXPECT_TRUE(seen[PUT_LAYER_STATE]);
+    EXPECT_TRUE(seen[PUT_MODS]);
+    EXPECT_EQ(loopback_slave_memory()->layers.layer_state, 1 << 5);
+    EXPECT_EQ(loopback_slave_memory()->mods.real_mods, 0x08);
+}
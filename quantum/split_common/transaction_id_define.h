@@ -21,8 +21,20 @@ enum serial_transaction_id {
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSPORT_MATRIX_SINGLE_READ
+    GET_SLAVE_MATRIX,
+#else  // SPLIT_TRANSPORT_MATRIX_SINGLE_READ
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
+#endif // SPLIT_TRANSPORT_MATRIX_SINGLE_READ
+
+#ifdef SPLIT_LINK_ADAPTIVE_SPEED
+    PUT_LINK_SPEED,
+#endif // SPLIT_LINK_ADAPTIVE_SPEED
+
+#ifdef SPLIT_TRANSACTION_BATCHING
+    PUT_BATCH,
+#endif // SPLIT_TRANSACTION_BATCHING
 
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
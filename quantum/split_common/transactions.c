@@ -64,6 +64,15 @@
 #ifdef WPM_ENABLE
 #    include "wpm.h"
 #endif
+#ifdef SPLIT_LINK_STATS_ENABLE
+#    include "link_stats.h"
+#endif
+#ifdef SPLIT_LINK_ADAPTIVE_SPEED
+#    if !defined(SPLIT_LINK_STATS_ENABLE) || !defined(SERIAL_DRIVER_USART) || defined(USE_I2C)
+#        error "SPLIT_LINK_ADAPTIVE_SPEED requires SPLIT_LINK_STATS_ENABLE and the usart serial driver"
+#    endif
+#    include "serial_protocol.h"
+#endif
 
 #define SYNC_TIMER_OFFSET 2
 
@@ -88,6 +97,16 @@
 #define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
 #define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
 
+#ifdef SPLIT_LINK_STATS_ENABLE
+#    define link_stats_checksum_error(id) split_link_stats_checksum_error(id)
+#    define link_stats_handler_result(attempt, okay) split_link_stats_handler_result(attempt, okay)
+#    define link_attempts() split_link_attempts()
+#else
+#    define link_stats_checksum_error(id)
+#    define link_stats_handler_result(attempt, okay)
+#    define link_attempts() 10
+#endif // SPLIT_LINK_STATS_ENABLE
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
 void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
@@ -98,7 +117,7 @@ void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *i
 // Helpers
 
 static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])) {
-    int num_retries = is_transport_connected() ? 10 : 1;
+    int num_retries = is_transport_connected() ? link_attempts() : 1;
     for (int iter = 1; iter <= num_retries; ++iter) {
         if (iter > 1) {
             for (int i = 0; i < iter * iter; ++i) {
@@ -107,8 +126,12 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         }
         bool this_okay = true;
         this_okay      = handler(master_matrix, slave_matrix);
-        if (this_okay) return true;
+        if (this_okay) {
+            link_stats_handler_result(iter, true);
+            return true;
+        }
     }
+    link_stats_handler_result(num_retries, false);
     dprintf("Failed to execute %s\n", prefix);
     return false;
 }
@@ -144,12 +167,145 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
+#ifdef SPLIT_TRANSACTION_BATCHING
+
+// Each record in a batch frame is the transaction ID, the offset into its shared memory block, the length, then the
+// bytes that differ from what the slave last acknowledged
+#    define BATCH_RECORD_HEADER 3
+
+// A serial transaction always sends the whole registered buffer, so only I2C gains from trimming records to deltas
+#    if defined(USE_I2C) && !defined(SPLIT_TRANSACTION_BATCH_DELTAS)
+#        define SPLIT_TRANSACTION_BATCH_DELTAS
+#    endif
+
+static split_batch_sync_t batch_frame;
+static bool               batch_open   = false;
+static bool               batch_resync = true;
+
+static bool batch_apply(const split_batch_sync_t *frame, bool execute_callbacks) {
+    if (frame->length > sizeof(frame->data) || frame->checksum != crc8(&frame->length, sizeof(frame->length) + frame->length)) {
+        return false;
+    }
+    for (uint8_t pos = 0; pos < frame->length;) {
+        const uint8_t *record = &frame->data[pos];
+        const uint8_t  id     = record[0];
+        const uint8_t  offset = record[1];
+        const uint8_t  size   = record[2];
+        pos += BATCH_RECORD_HEADER + size;
+        if (id >= NUM_TOTAL_TRANSACTIONS || pos > frame->length) {
+            return false;
+        }
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (offset + size > trans->initiator2target_buffer_size) {
+            return false;
+        }
+        memcpy(split_trans_initiator2target_buffer(trans) + offset, &record[BATCH_RECORD_HEADER], size);
+        if (execute_callbacks && trans->slave_callback) {
+            trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        }
+    }
+    return true;
+}
+
+static bool batch_send(void) {
+    split_batch_ack_t ack;
+    batch_frame.checksum = crc8(&batch_frame.length, sizeof(batch_frame.length) + batch_frame.length);
+    if (!transport_execute_transaction(PUT_BATCH, &batch_frame, offsetof(split_batch_sync_t, data) + batch_frame.length, &ack, sizeof(ack))) {
+        // Keep the frame staged until it is acknowledged, even across scans, as its writers have already been told it
+        // went out. The slave may have lost track in the meantime, so later records carry whole blocks.
+        batch_resync = true;
+        return false;
+    }
+    if (ack.checksum != batch_frame.checksum) {
+        link_stats_checksum_error(PUT_BATCH);
+        batch_resync = true;
+        return false;
+    }
+
+    // The slave now holds these records, so they become the reference for the next deltas
+    batch_apply(&batch_frame, false);
+    batch_frame.length = 0;
+    batch_resync       = false;
+    return true;
+}
+
+// Drops the record staged for a transaction, if any. Every record is relative to what the slave last acknowledged, so
+// a newer one for the same transaction carries everything the older one did.
+static void batch_drop(int8_t id) {
+    for (uint8_t pos = 0; pos < batch_frame.length;) {
+        uint8_t      *record = &batch_frame.data[pos];
+        const uint8_t size   = BATCH_RECORD_HEADER + record[2];
+        if (record[0] == id) {
+            memmove(record, record + size, batch_frame.length - pos - size);
+            batch_frame.length -= size;
+            return;
+        }
+        pos += size;
+    }
+}
+
+static bool batch_write(int8_t id, const void *data, uint16_t length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (!batch_open || trans->initiator2target_buffer_size + BATCH_RECORD_HEADER > sizeof(batch_frame.data)) {
+        return transport_execute_transaction(id, data, length, NULL, 0);
+    }
+
+    const uint8_t *source = data;
+    const uint8_t *acked  = split_trans_initiator2target_buffer(trans);
+    uint8_t        first  = 0;
+    uint8_t        last   = length < trans->initiator2target_buffer_size ? length : trans->initiator2target_buffer_size;
+#    ifdef SPLIT_TRANSACTION_BATCH_DELTAS
+    if (!batch_resync) {
+        while (first < last && source[first] == acked[first]) {
+            first++;
+        }
+        if (first == last) {
+            // Nothing changed, so this is a forced sync: resend the whole block in case the slave lost it
+            first = 0;
+        } else {
+            while (source[last - 1] == acked[last - 1]) {
+                last--;
+            }
+        }
+    }
+#    else
+    (void)acked;
+#    endif
+
+    batch_drop(id);
+
+    const uint8_t size = last - first;
+    if (batch_frame.length + BATCH_RECORD_HEADER + size > sizeof(batch_frame.data) && !batch_send()) {
+        return false;
+    }
+
+    uint8_t *record = &batch_frame.data[batch_frame.length];
+    record[0]       = id;
+    record[1]       = first;
+    record[2]       = size;
+    memcpy(&record[BATCH_RECORD_HEADER], &source[first], size);
+    batch_frame.length += BATCH_RECORD_HEADER + size;
+    return true;
+}
+
+static void batch_begin(void) {
+    batch_open = true;
+}
+
+#    undef transport_write
+#    define transport_write(id, data, length) batch_write(id, data, length)
+
+#endif // SPLIT_TRANSACTION_BATCHING
+
 inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
     if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
         okay &= transport_read(trans_id_retrieve, destination, length);
-        okay &= curr_checksum == crc8(equiv_shmem, length);
+        if (okay && curr_checksum != crc8(equiv_shmem, length)) {
+            link_stats_checksum_error(trans_id_retrieve);
+            okay = false;
+        }
         if (okay) {
             *last_update = timer_read32();
         }
@@ -178,6 +334,25 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#if defined(SPLIT_TRANSPORT_MATRIX_SINGLE_READ)
+static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static matrix_row_t       last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
+    split_slave_matrix_sync_t temp_sync;                            // holding area while we test whether or not checksum is correct
+
+    // Checksum and matrix arrive together, so a slave-side change is delivered in a single round trip
+    bool okay = transport_read(GET_SLAVE_MATRIX, &temp_sync, sizeof(temp_sync));
+    if (okay && temp_sync.checksum != crc8(temp_sync.matrix, sizeof(temp_sync.matrix))) {
+        link_stats_checksum_error(GET_SLAVE_MATRIX);
+        okay = false;
+    }
+    if (okay) {
+        memcpy(last_matrix, temp_sync.matrix, sizeof(temp_sync.matrix));
+    }
+    // Copy out the last-known-good matrix state to the slave matrix
+    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    return okay;
+}
+#else
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
@@ -192,6 +367,7 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
     memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
     return okay;
 }
+#endif // defined(SPLIT_TRANSPORT_MATRIX_SINGLE_READ)
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
@@ -199,13 +375,158 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#ifdef SPLIT_TRANSACTION_BATCHING
+// The slave matrix is returned in the acknowledgement of the batch frame, or polled by the batch handler when idle
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER()
+#else
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#endif
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+#ifdef SPLIT_TRANSPORT_MATRIX_SINGLE_READ
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+    [GET_SLAVE_MATRIX] = trans_target2initiator_initializer(smatrix),
+#else
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
+#endif
+// clang-format on
+
+////////////////////////////////////////////////////
+// Link speed
+
+#ifdef SPLIT_LINK_ADAPTIVE_SPEED
+
+// Only touched from the context that answers transactions on the slave
+static uint8_t  link_speed_pending = 0;
+static uint32_t link_speed_contact = 0;
+
+static bool link_speed_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t last_update = 0;
+    static uint8_t  current     = 0;
+
+    if (!is_transport_connected()) {
+        // The slave falls back to the configured speed once it stops hearing from us
+        split_link_speed_reset();
+        if (current) {
+            current = 0;
+            serial_transport_driver_set_speed_step(current);
+        }
+    }
+
+    uint8_t target = split_link_speed_step();
+    if (target == current && timer_elapsed32(last_update) < FORCED_SYNC_THROTTLE_MS) {
+        return true;
+    }
+
+    // Also sent periodically at the current speed, which keeps the slave from falling back
+    split_link_speed_sync_t sync = {.step = target, .checksum = (uint8_t)~target};
+    uint8_t                 ack  = 0xFF;
+    if (!transport_execute_transaction(PUT_LINK_SPEED, &sync, sizeof(sync), &ack, sizeof(ack)) || ack != target) {
+        return false;
+    }
+    last_update = timer_read32();
+    if (target != current) {
+        // The slave switches right after sending the acknowledgement, transaction retries cover the restart
+        current = target;
+        serial_transport_driver_set_speed_step(current);
+    }
+    return true;
+}
+
+static void link_speed_handlers_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_link_speed_sync_t *sync = &split_shmem->link_speed;
+    if (sync->checksum == (uint8_t)~sync->step && sync->step <= SPLIT_LINK_SPEED_STEPS) {
+        link_speed_pending          = sync->step;
+        link_speed_contact          = timer_read32();
+        split_shmem->link_speed_ack = sync->step;
+    } else {
+        split_shmem->link_speed_ack = 0xFF;
+    }
+}
+
+void transactions_slave_link_speed_task(void) {
+    static uint8_t current = 0;
+
+    if (link_speed_pending && timer_elapsed32(link_speed_contact) > SPLIT_LINK_SPEED_TIMEOUT) {
+        link_speed_pending = 0;
+    }
+    if (link_speed_pending != current) {
+        current = link_speed_pending;
+        serial_transport_driver_set_speed_step(current);
+    }
+}
+
+// clang-format off
+#    define TRANSACTIONS_LINK_SPEED_MASTER() TRANSACTION_HANDLER_MASTER(link_speed)
+// The slave switches speed from its transport thread instead, see transactions_slave_link_speed_task()
+#    define TRANSACTIONS_LINK_SPEED_SLAVE()
+#    define TRANSACTIONS_LINK_SPEED_REGISTRATIONS \
+    [PUT_LINK_SPEED] = { sizeof_member(split_shared_memory_t, link_speed), offsetof(split_shared_memory_t, link_speed), sizeof_member(split_shared_memory_t, link_speed_ack), offsetof(split_shared_memory_t, link_speed_ack), link_speed_handlers_slave_callback },
+// clang-format on
+
+#else // SPLIT_LINK_ADAPTIVE_SPEED
+
+#    define TRANSACTIONS_LINK_SPEED_MASTER()
+#    define TRANSACTIONS_LINK_SPEED_SLAVE()
+#    define TRANSACTIONS_LINK_SPEED_REGISTRATIONS
+
+#endif // SPLIT_LINK_ADAPTIVE_SPEED
+
+////////////////////////////////////////////////////
+// Batched transactions
+
+#ifdef SPLIT_TRANSACTION_BATCHING
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
+
+    if (batch_frame.length == 0) {
+        // Nothing changed, so poll the slave matrix the usual way instead of sending an empty frame
+        bool okay = slave_matrix_handlers_master(master_matrix, slave_matrix);
+        if (okay) {
+            memcpy(last_matrix, slave_matrix, sizeof(last_matrix));
+        }
+        return okay;
+    }
+
+    bool okay = batch_send();
+    if (okay && split_shmem->batch_ack.smatrix.checksum != crc8(split_shmem->batch_ack.smatrix.matrix, sizeof(split_shmem->batch_ack.smatrix.matrix))) {
+        link_stats_checksum_error(PUT_BATCH);
+        okay = false;
+    }
+    if (okay) {
+        memcpy(last_matrix, split_shmem->batch_ack.smatrix.matrix, sizeof(last_matrix));
+        // Keep the idle checksum poll in step with the matrix that came back with the frame
+        memcpy(&split_shmem->smatrix, &split_shmem->batch_ack.smatrix, sizeof(split_shmem->smatrix));
+    }
+    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    return okay;
+}
+
+static void batch_handlers_slave(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_batch_sync_t *frame       = &split_shmem->batch;
+    split_shmem->batch_ack.checksum = batch_apply(frame, true) ? frame->checksum : (uint8_t)~frame->checksum;
+    memcpy(&split_shmem->batch_ack.smatrix, &split_shmem->smatrix, sizeof(split_shmem->smatrix));
+}
+
+// clang-format off
+#    define TRANSACTIONS_BATCH_BEGIN() batch_begin()
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_END() (batch_open = false)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS \
+    [PUT_BATCH] = { sizeof_member(split_shared_memory_t, batch), offsetof(split_shared_memory_t, batch), sizeof_member(split_shared_memory_t, batch_ack), offsetof(split_shared_memory_t, batch_ack), batch_handlers_slave },
 // clang-format on
 
+#else // SPLIT_TRANSACTION_BATCHING
+
+#    define TRANSACTIONS_BATCH_BEGIN()
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_END()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSACTION_BATCHING
+
 ////////////////////////////////////////////////////
 // Master matrix
 
@@ -301,8 +622,9 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
 
     bool okay = true;
     if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
+        // Never batched, as a queued timestamp would go stale while its frame waits to be acknowledged
         uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
-        okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
+        okay &= transport_execute_transaction(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer), NULL, 0);
         if (okay) {
             last_update = timer_read32();
         }
@@ -926,6 +1248,8 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 
     // clang-format off
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
+    TRANSACTIONS_LINK_SPEED_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
     TRANSACTIONS_SYNC_TIMER_REGISTRATIONS
@@ -954,7 +1278,8 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 };
 
-bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+static bool transactions_master_handlers(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_LINK_SPEED_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -974,10 +1299,19 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_BATCH_MASTER();
     return true;
 }
 
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_BATCH_BEGIN();
+    bool okay = transactions_master_handlers(master_matrix, slave_matrix);
+    TRANSACTIONS_BATCH_END();
+    return okay;
+}
+
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_LINK_SPEED_SLAVE();
     TRANSACTIONS_SLAVE_MATRIX_SLAVE();
     TRANSACTIONS_MASTER_MATRIX_SLAVE();
     TRANSACTIONS_ENCODERS_SLAVE();
@@ -22,6 +22,10 @@
 #include "transaction_id_define.h"
 #include "atomic_util.h"
 
+#ifdef SPLIT_LINK_STATS_ENABLE
+#    include "link_stats.h"
+#endif
+
 #ifdef USE_I2C
 
 #    ifndef SLAVE_I2C_TIMEOUT
@@ -59,7 +63,7 @@ i2c_status_t transport_trigger_callback(int8_t id) {
     return i2c_write_register(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size, SLAVE_I2C_TIMEOUT);
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+static bool transport_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     i2c_status_t              status;
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
@@ -100,7 +104,7 @@ void transport_slave_init(void) {
     soft_serial_target_init();
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+static bool transport_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
@@ -121,6 +125,17 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 
 #endif // USE_I2C
 
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+#ifdef SPLIT_LINK_STATS_ENABLE
+    uint32_t start = split_link_stats_timestamp();
+    bool     okay  = transport_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    split_link_stats_record(id, okay, split_link_stats_timestamp() - start);
+    return okay;
+#else
+    return transport_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+#endif // SPLIT_LINK_STATS_ENABLE
+}
+
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     return transactions_master(master_matrix, slave_matrix);
 }
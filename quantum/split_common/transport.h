@@ -57,6 +57,30 @@ typedef struct _split_slave_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
+#ifdef SPLIT_TRANSACTION_BATCHING
+#    ifndef SPLIT_TRANSACTION_BATCH_SIZE
+#        define SPLIT_TRANSACTION_BATCH_SIZE 32
+#    endif // SPLIT_TRANSACTION_BATCH_SIZE
+
+typedef struct _split_batch_sync_t {
+    uint8_t checksum; // crc8 over length and data
+    uint8_t length;
+    uint8_t data[SPLIT_TRANSACTION_BATCH_SIZE];
+} split_batch_sync_t;
+
+typedef struct _split_batch_ack_t {
+    uint8_t                   checksum; // checksum of the last frame the slave applied
+    split_slave_matrix_sync_t smatrix;
+} split_batch_ack_t;
+#endif // SPLIT_TRANSACTION_BATCHING
+
+#ifdef SPLIT_LINK_ADAPTIVE_SPEED
+typedef struct _split_link_speed_sync_t {
+    uint8_t step;     // number of times the configured speed is halved
+    uint8_t checksum; // inverted step, a corrupted speed change would lose the link
+} split_link_speed_sync_t;
+#endif // SPLIT_LINK_ADAPTIVE_SPEED
+
 #ifdef SPLIT_TRANSPORT_MIRROR
 typedef struct _split_master_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -154,6 +178,16 @@ typedef struct _split_shared_memory_t {
 
     split_slave_matrix_sync_t smatrix;
 
+#ifdef SPLIT_TRANSACTION_BATCHING
+    split_batch_sync_t batch;
+    split_batch_ack_t  batch_ack;
+#endif // SPLIT_TRANSACTION_BATCHING
+
+#ifdef SPLIT_LINK_ADAPTIVE_SPEED
+    split_link_speed_sync_t link_speed;
+    uint8_t                 link_speed_ack;
+#endif // SPLIT_LINK_ADAPTIVE_SPEED
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
 #endif // SPLIT_TRANSPORT_MIRROR
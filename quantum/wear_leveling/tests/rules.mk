@@ -63,4 +63,40 @@ wear_leveling_8byte_SRC := \
 	$(wear_leveling_common_SRC) \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
-	$(wear_leveling_common_INC)
\ No newline at end of file
+	$(wear_leveling_common_INC)
+
+wear_leveling_deferred_2byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DWEAR_LEVELING_DEFERRED_WRITES \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=512 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=128
+wear_leveling_deferred_2byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_deferred.cpp
+wear_leveling_deferred_2byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_deferred_4byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DWEAR_LEVELING_DEFERRED_WRITES \
+	-DBACKING_STORE_WRITE_SIZE=4 \
+	-DWEAR_LEVELING_BACKING_SIZE=512 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=128
+wear_leveling_deferred_4byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_deferred.cpp
+wear_leveling_deferred_4byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_deferred_8byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DWEAR_LEVELING_DEFERRED_WRITES \
+	-DBACKING_STORE_WRITE_SIZE=8 \
+	-DWEAR_LEVELING_BACKING_SIZE=512 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=128
+wear_leveling_deferred_8byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_deferred.cpp
+wear_leveling_deferred_8byte_INC := \
+	$(wear_leveling_common_INC)
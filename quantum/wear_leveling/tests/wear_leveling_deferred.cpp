@@ -0,0 +1,198 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingDeferred : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+    }
+
+    static std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    static wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    // Re-initialises from the backing store and checks everything written so far was stored
+    static void verify_stored(void) {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+        EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), WEAR_LEVELING_LOGICAL_SIZE) == 0) << "Readback did not match";
+    }
+};
+
+std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> WearLevelingDeferred::verify_data;
+
+/**
+ * This test verifies that writes only update the cache until they are flushed.
+ */
+TEST_F(WearLevelingDeferred, WritesHeldUntilFlush) {
+    auto&   inst       = MockBackingStore::Instance();
+    uint8_t test_value = 0x15;
+
+    EXPECT_FALSE(wear_leveling_flush_pending()) << "Nothing should be pending after init";
+    EXPECT_EQ(test_write(0x42, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_TRUE(wear_leveling_flush_pending()) << "Write should be pending";
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 0) << "Write should not have reached the backing store";
+
+    uint8_t readback = 0;
+    EXPECT_EQ(wear_leveling_read(0x42, &readback, sizeof(readback)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(readback, test_value) << "Reads should be served the pending value";
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_FALSE(wear_leveling_flush_pending()) << "Nothing should be pending after a flush";
+    EXPECT_EQ(inst.log_begin()->address, WEAR_LEVELING_LOGICAL_SIZE + 8) << "Invalid first write address.";
+    verify_stored();
+}
+
+/**
+ * This test verifies that repeated writes to the same location are logged once.
+ */
+TEST_F(WearLevelingDeferred, RepeatedWritesCoalesced) {
+    auto& inst = MockBackingStore::Instance();
+
+    for (uint8_t i = 1; i <= 100; ++i) {
+        EXPECT_EQ(test_write(0x42, &i, sizeof(i)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+
+    write_log_entry_t e;
+    e.raw64 = 0;
+    memcpy(&e, &inst.log_begin()->value, sizeof(backing_store_int_t));
+    if (BACKING_STORE_WRITE_SIZE == 2) {
+        memcpy(&e.raw8[2], &(inst.log_begin() + 1)->value, sizeof(backing_store_int_t));
+    }
+    EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_MULTIBYTE) << "Invalid write log entry type";
+    EXPECT_EQ(LOG_ENTRY_MULTIBYTE_GET_ADDRESS(e), 0x42) << "Invalid write log entry address";
+    EXPECT_EQ(inst.erasure_count(), 0) << "Nothing should have been consolidated";
+    verify_stored();
+}
+
+/**
+ * This test verifies that adjacent writes are merged and logged as a single run entry.
+ */
+TEST_F(WearLevelingDeferred, AdjacentWritesLoggedAsRun) {
+    auto& inst = MockBackingStore::Instance();
+
+    for (uint16_t i = 0; i < 32; ++i) {
+        uint16_t value = 0x1234 + i;
+        EXPECT_EQ(test_write(0x40 + i * 2, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+
+    // One header followed by the values, rounded up to the write size
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), (LOG_ENTRY_RUN_HEADER_BYTES + 64 + BACKING_STORE_WRITE_SIZE - 1) / BACKING_STORE_WRITE_SIZE);
+
+    write_log_entry_t e;
+    e.raw64 = 0;
+    memcpy(&e, &inst.log_begin()->value, sizeof(backing_store_int_t));
+    if (BACKING_STORE_WRITE_SIZE == 2) {
+        memcpy(&e.raw8[2], &(inst.log_begin() + 1)->value, sizeof(backing_store_int_t));
+    }
+    EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_RUN) << "Invalid write log entry type";
+    EXPECT_EQ(LOG_ENTRY_RUN_GET_ADDRESS(e), 0x40) << "Invalid write log entry address";
+    EXPECT_EQ(LOG_ENTRY_RUN_GET_LENGTH(e), 64) << "Invalid write log entry length";
+    verify_stored();
+}
+
+/**
+ * This test verifies that runs containing whole backing store writes of zero play back, and that later entries follow them.
+ */
+TEST_F(WearLevelingDeferred, RunWithZeroValues) {
+    std::array<std::uint8_t, 40> testvalue;
+    std::fill(testvalue.begin(), testvalue.end(), 0xFF);
+    EXPECT_EQ(test_write(0x08, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+
+    std::fill(testvalue.begin() + 1, testvalue.end() - 1, 0x00);
+    EXPECT_EQ(test_write(0x08, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+
+    uint8_t test_value = 0x33;
+    EXPECT_EQ(test_write(0x70, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    verify_stored();
+}
+
+/**
+ * This test verifies that scattered writes beyond the number of tracked ranges are still all stored.
+ */
+TEST_F(WearLevelingDeferred, ScatteredWritesMerged) {
+    for (uint8_t i = 0; i < WEAR_LEVELING_DEFERRED_WRITES_MAX_RANGES * 2; ++i) {
+        uint8_t value = 0x80 + i;
+        EXPECT_EQ(test_write((i * 37) % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    verify_stored();
+}
+
+/**
+ * This test verifies that a flush which does not fit in the write log consolidates instead.
+ */
+TEST_F(WearLevelingDeferred, FlushOverflowConsolidates) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> testvalue;
+
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (int i = 0; i < 32 && status == WEAR_LEVELING_SUCCESS; ++i) {
+        std::iota(testvalue.begin(), testvalue.end(), 0x20 + i);
+        EXPECT_EQ(test_write(0, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        status = wear_leveling_flush();
+    }
+    EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Flush should have consolidated";
+    EXPECT_EQ(inst.erasure_count(), 1) << "Invalid erase count";
+    EXPECT_FALSE(wear_leveling_flush_pending()) << "Consolidation should have stored everything pending";
+    verify_stored();
+}
+
+/**
+ * This test verifies that rewriting the whole logical area many times between flushes does not wear the backing store.
+ */
+TEST_F(WearLevelingDeferred, BulkUpdatesDoNotConsolidate) {
+    auto& inst = MockBackingStore::Instance();
+
+    for (int pass = 0; pass < 10; ++pass) {
+        for (uint32_t address = 0; address < 64; address += 2) {
+            uint16_t value = pass * 100 + address;
+            EXPECT_EQ(test_write(address, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        }
+    }
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(inst.erasure_count(), 0) << "Nothing should have been consolidated";
+    verify_stored();
+}
+
+/**
+ * This test verifies run readback gets canceled with an out-of-bounds address.
+ */
+TEST_F(WearLevelingDeferred, PlaybackReadbackRun_OOB) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, 16> testvalue;
+    std::iota(testvalue.begin(), testvalue.end(), 0x20);
+    EXPECT_EQ(test_write(0x10, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+
+    // Append a run at an out of bounds address directly after the flushed one
+    auto entry  = LOG_ENTRY_MAKE_RUN(WEAR_LEVELING_LOGICAL_SIZE, 1);
+    auto logpos = inst.storage_begin() + std::distance(inst.log_begin(), inst.log_end()) + (WEAR_LEVELING_LOGICAL_SIZE + 8) / sizeof(backing_store_int_t);
+    for (std::size_t i = 0; i < LOG_ENTRY_RUN_HEADER_BYTES; i += sizeof(backing_store_int_t)) {
+        backing_store_int_t value;
+        memcpy(&value, &entry.raw8[i], sizeof(value));
+        (logpos++)->set(~value);
+    }
+
+    EXPECT_EQ(inst.erasure_count(), 0) << "Invalid initial erase count";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_CONSOLIDATED) << "Readback should have failed and triggered consolidation";
+    EXPECT_EQ(inst.erasure_count(), 1) << "Invalid final erase count";
+    verify_stored();
+}
@@ -76,6 +76,12 @@
             * A new write log entry is appended to the log.
             * If the log's full, data is consolidated and the write log cleared.
 
+        During writes, with WEAR_LEVELING_DEFERRED_WRITES:
+            * The cache is updated with the new data.
+            * The written range is merged into a small set of pending ranges.
+            * Pending ranges are appended to the log when flushed, using run
+                entries for anything longer than a multi-byte entry.
+
     Write log structure:
 
         The first 8 bytes of the write log are a FNV1a_64 hash of the contents
@@ -153,7 +159,23 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Run log entries:
+
+        Longer spans of data, as produced when flushing deferred writes, are
+        stored as a single header followed by up to 128 value bytes, padded
+        with zeros to a multiple of the backing store write size. The header
+        is the first 4 bytes of the entry:
+
+        ╔ Run Log Entry ════════════════════╗
+        ║11000YYY║YYYYYYYY║YYYYYYYY║LLLLLLLL║Value[0]...Value[L-1]
+        ║     └┬┘║└──┬───┘║└──┬───┘║└──┬───┘║
+        ║  Address Address║ Address║ Length ║
+        ╚════════╩════════╩════════╩════════╝
+
+        Value bytes may include whole backing store writes of zero, so the
+        length in the header determines where the next entry begins. */
 
 /**
  * Storage area for the wear-leveling cache.
@@ -162,6 +184,13 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_DEFERRED_WRITES
+    struct {
+        uint32_t start;
+        uint32_t end;
+    } pending[(WEAR_LEVELING_DEFERRED_WRITES_MAX_RANGES) + 1]; // sorted, non-overlapping ranges of the cache not yet in the write log
+    uint8_t pending_count;
+#endif
 } wear_leveling;
 
 /**
@@ -203,6 +232,9 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+#ifdef WEAR_LEVELING_DEFERRED_WRITES
+    wear_leveling.pending_count = 0;
+#endif
 }
 
 /**
@@ -314,6 +346,12 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     if (status == WEAR_LEVELING_FAILED) {
         wl_dprintf("Failed to write consolidated data\n");
     }
+#ifdef WEAR_LEVELING_DEFERRED_WRITES
+    else {
+        // Everything in the cache is now stored, including any pending writes
+        wear_leveling.pending_count = 0;
+    }
+#endif
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
@@ -469,6 +507,38 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+#ifdef WEAR_LEVELING_DEFERRED_WRITES
+/**
+ * Handles writing run-encoded data to the backing store.
+ * Consolidates instead if the entry does not fit in the remainder of the write log, as the cache already holds the data.
+ *
+ * @return true if consolidation occurred
+ */
+static wear_leveling_status_t wear_leveling_write_raw_run(uint32_t address, const void *value, size_t length) {
+    const size_t entry_size = (LOG_ENTRY_RUN_HEADER_BYTES + length + (BACKING_STORE_WRITE_SIZE) - 1) / (BACKING_STORE_WRITE_SIZE) * (BACKING_STORE_WRITE_SIZE);
+    if (wear_leveling.write_address + entry_size > (WEAR_LEVELING_BACKING_SIZE)) {
+        return wear_leveling_consolidate_force();
+    }
+
+    // See the run log format in the documentation header at the top of the file.
+    union {
+        backing_store_int_t values[LOG_ENTRY_RUN_MAX_WRITES];
+        uint8_t             raw8[LOG_ENTRY_RUN_MAX_WRITES * (BACKING_STORE_WRITE_SIZE)];
+    } entry;
+    const write_log_entry_t header = LOG_ENTRY_MAKE_RUN(address, length);
+    memset(&entry, 0, entry_size);
+    memcpy(&entry.raw8[0], header.raw8, LOG_ENTRY_RUN_HEADER_BYTES);
+    memcpy(&entry.raw8[LOG_ENTRY_RUN_HEADER_BYTES], value, length);
+
+    if (!backing_store_write_bulk(wear_leveling.write_address, entry.values, entry_size / (BACKING_STORE_WRITE_SIZE))) {
+        wl_dprintf("Failed to write to backing store\n");
+        return WEAR_LEVELING_FAILED;
+    }
+    wear_leveling.write_address += entry_size;
+    return wear_leveling_consolidate_if_needed();
+}
+#endif // WEAR_LEVELING_DEFERRED_WRITES
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
@@ -590,6 +660,48 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 wear_leveling.cache[a + 1] = 0;
             } break;
 #endif // BACKING_STORE_WRITE_SIZE == 2
+            case LOG_ENTRY_TYPE_RUN: {
+#if BACKING_STORE_WRITE_SIZE == 2
+                ok = backing_store_read(address, &log.raw16[1]);
+                if (!ok) {
+                    wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+                    cancel_playback = true;
+                    status          = WEAR_LEVELING_FAILED;
+                    break;
+                }
+                address += (BACKING_STORE_WRITE_SIZE);
+#endif // BACKING_STORE_WRITE_SIZE == 2
+                const uint32_t a = LOG_ENTRY_RUN_GET_ADDRESS(log);
+                const uint8_t  l = LOG_ENTRY_RUN_GET_LENGTH(log);
+
+                if (l == 0 || a + l > (WEAR_LEVELING_LOGICAL_SIZE)) {
+                    cancel_playback = true;
+                    status          = WEAR_LEVELING_FAILED;
+                    break;
+                }
+
+                // Values which share the first backing store write with the header
+                uint8_t n = 0;
+                for (uint8_t i = LOG_ENTRY_RUN_HEADER_BYTES; i < (BACKING_STORE_WRITE_SIZE) && n < l; ++i) {
+                    wear_leveling.cache[a + n++] = log.raw8[i];
+                }
+
+                // Remaining values, which may legitimately be zero
+                while (n < l) {
+                    if (address >= (WEAR_LEVELING_BACKING_SIZE) || !backing_store_read(address, &value)) {
+                        wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+                        cancel_playback = true;
+                        status          = WEAR_LEVELING_FAILED;
+                        break;
+                    }
+                    address += (BACKING_STORE_WRITE_SIZE);
+
+                    const uint8_t *p = (const uint8_t *)&value;
+                    for (uint8_t i = 0; i < (BACKING_STORE_WRITE_SIZE) && n < l; ++i) {
+                        wear_leveling.cache[a + n++] = p[i];
+                    }
+                }
+            } break;
             default: {
                 cancel_playback = true;
                 status          = WEAR_LEVELING_FAILED;
@@ -671,6 +783,51 @@ wear_leveling_status_t wear_leveling_erase(void) {
     return ret ? WEAR_LEVELING_SUCCESS : WEAR_LEVELING_FAILED;
 }
 
+#ifdef WEAR_LEVELING_DEFERRED_WRITES
+/**
+ * Adds a range of the cache to the pending ranges, merging it with any it overlaps or touches.
+ * If there are too many ranges, the two closest to each other are merged, which may include unchanged data in between.
+ */
+static void wear_leveling_defer(uint32_t start, uint32_t end) {
+    // Find the first range which could be merged with the new one
+    uint8_t first = 0;
+    while (first < wear_leveling.pending_count && wear_leveling.pending[first].end < start) {
+        ++first;
+    }
+
+    // Absorb every range overlapping or touching the new one
+    uint8_t last = first;
+    while (last < wear_leveling.pending_count && wear_leveling.pending[last].start <= end) {
+        if (wear_leveling.pending[last].start < start) {
+            start = wear_leveling.pending[last].start;
+        }
+        if (wear_leveling.pending[last].end > end) {
+            end = wear_leveling.pending[last].end;
+        }
+        ++last;
+    }
+
+    // Replace the absorbed ranges with the merged one
+    memmove(&wear_leveling.pending[first + 1], &wear_leveling.pending[last], (wear_leveling.pending_count - last) * sizeof(wear_leveling.pending[0]));
+    wear_leveling.pending_count -= last - first;
+    wear_leveling.pending[first].start = start;
+    wear_leveling.pending[first].end   = end;
+    wear_leveling.pending_count++;
+
+    if (wear_leveling.pending_count > (WEAR_LEVELING_DEFERRED_WRITES_MAX_RANGES)) {
+        uint8_t closest = 0;
+        for (uint8_t i = 1; i < wear_leveling.pending_count - 1; ++i) {
+            if (wear_leveling.pending[i + 1].start - wear_leveling.pending[i].end < wear_leveling.pending[closest + 1].start - wear_leveling.pending[closest].end) {
+                closest = i;
+            }
+        }
+        wear_leveling.pending[closest].end = wear_leveling.pending[closest + 1].end;
+        memmove(&wear_leveling.pending[closest + 1], &wear_leveling.pending[closest + 2], (wear_leveling.pending_count - closest - 2) * sizeof(wear_leveling.pending[0]));
+        wear_leveling.pending_count--;
+    }
+}
+#endif // WEAR_LEVELING_DEFERRED_WRITES
+
 /**
  * Writes logical data into the backing store. Skips writes if there are no changes to values.
  */
@@ -691,6 +848,12 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
+#ifdef WEAR_LEVELING_DEFERRED_WRITES
+    // The write log is appended to by wear_leveling_flush(), so that repeated writes to the same data are only logged once
+    wear_leveling_defer(address, address + length);
+    return WEAR_LEVELING_SUCCESS;
+#endif
+
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -726,6 +889,73 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+/**
+ * Appends deferred writes to the write log.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+#ifdef WEAR_LEVELING_DEFERRED_WRITES
+    if (wear_leveling.pending_count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Flush\n");
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // Ranges are only dropped once logged, a failure leaves them for the next flush. Consolidation drops all of them.
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    while (status == WEAR_LEVELING_SUCCESS && wear_leveling.pending_count > 0) {
+        uint32_t address   = wear_leveling.pending[0].start;
+        size_t   remaining = wear_leveling.pending[0].end - address;
+        while (status == WEAR_LEVELING_SUCCESS && remaining > 0) {
+            size_t this_length = remaining;
+            if (remaining > LOG_ENTRY_MULTIBYTE_MAX_BYTES) {
+                // Anything longer than a single multi-byte entry is denser as a run
+                if (this_length > LOG_ENTRY_RUN_MAX_BYTES) {
+                    this_length = LOG_ENTRY_RUN_MAX_BYTES;
+                }
+                status = wear_leveling_write_raw_run(address, &wear_leveling.cache[address], this_length);
+            } else {
+                status = wear_leveling_write_raw(address, &wear_leveling.cache[address], this_length);
+            }
+            remaining -= this_length;
+            address += (uint32_t)this_length;
+        }
+
+        if (status == WEAR_LEVELING_SUCCESS) {
+            wear_leveling.pending_count--;
+            memmove(&wear_leveling.pending[0], &wear_leveling.pending[1], wear_leveling.pending_count * sizeof(wear_leveling.pending[0]));
+        }
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+#else
+    return WEAR_LEVELING_SUCCESS;
+#endif // WEAR_LEVELING_DEFERRED_WRITES
+}
+
+/**
+ * Checks whether there are deferred writes waiting for wear_leveling_flush().
+ */
+bool wear_leveling_flush_pending(void) {
+#ifdef WEAR_LEVELING_DEFERRED_WRITES
+    return wear_leveling.pending_count > 0;
+#else
+    return false;
+#endif
+}
+
 /**
  * Reads logical data from the cache.
  */
@@ -1,6 +1,7 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 #pragma once
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -36,6 +37,9 @@ wear_leveling_status_t wear_leveling_erase(void);
  * determine if an overwrite should occur -- if there is any data mismatch the entire block will be written to the log,
  * not just the changed bytes.
  *
+ * With WEAR_LEVELING_DEFERRED_WRITES defined, only the cache is updated and the written range is remembered until the
+ * next call to wear_leveling_flush().
+ *
  * @param address[in] the logical address to write data
  * @param value[in] pointer to the source buffer
  * @param length[in] length of the data
@@ -43,6 +47,23 @@ wear_leveling_status_t wear_leveling_erase(void);
  */
 wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value, size_t length);
 
+/**
+ * Writes any deferred logical data into the backing store.
+ *
+ * Ranges written since the last flush are appended to the write log once each, no matter how many times they were
+ * written. Does nothing unless WEAR_LEVELING_DEFERRED_WRITES is defined.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
+
+/**
+ * Checks whether any deferred logical data is waiting to be flushed.
+ *
+ * @return true if wear_leveling_flush() has work to do
+ */
+bool wear_leveling_flush_pending(void);
+
 /**
  * Reads logical data from the cache.
  *
@@ -27,6 +27,12 @@ typedef uint64_t backing_store_int_t;
 #    error WEAR_LEVELING_LOGICAL_SIZE was not set.
 #endif
 
+#ifdef WEAR_LEVELING_DEFERRED_WRITES
+#    ifndef WEAR_LEVELING_DEFERRED_WRITES_MAX_RANGES
+#        define WEAR_LEVELING_DEFERRED_WRITES_MAX_RANGES 8
+#    endif
+#endif
+
 #ifdef WEAR_LEVELING_DEBUG_OUTPUT
 #    include <debug.h>
 #    define bs_dprintf(...) dprintf("Backing store: " __VA_ARGS__)
@@ -101,6 +107,9 @@ enum {
     // 0x02 -- 2-byte backing store write optimization: word-encoded 0/1 values
     LOG_ENTRY_TYPE_WORD_01,
 
+    // 0x03 -- Run of bytes spanning multiple backing store writes
+    LOG_ENTRY_TYPE_RUN,
+
     LOG_ENTRY_TYPES
 };
 
@@ -149,3 +158,20 @@ _Static_assert(LOG_ENTRY_TYPES <= (1 << 2), "Too many log entry types to fit int
             [1] = (uint8_t)((address) >> 1), /* address */                                            \
         }                                                                                             \
     }
+
+#define LOG_ENTRY_RUN_HEADER_BYTES 4
+#define LOG_ENTRY_RUN_MAX_BYTES 128
+#define LOG_ENTRY_RUN_MAX_WRITES ((LOG_ENTRY_RUN_HEADER_BYTES + LOG_ENTRY_RUN_MAX_BYTES + (BACKING_STORE_WRITE_SIZE) - 1) / (BACKING_STORE_WRITE_SIZE))
+#define LOG_ENTRY_RUN_GET_ADDRESS(entry) (((((uint32_t)((entry).raw8[0])) & BITMASK_FOR_BITCOUNT(3)) << 16) | (((uint32_t)((entry).raw8[1])) << 8) | (entry).raw8[2])
+#define LOG_ENTRY_RUN_GET_LENGTH(entry) ((entry).raw8[3])
+#define LOG_ENTRY_MAKE_RUN(address, length)                                                       \
+    (write_log_entry_t) {                                                                         \
+        .raw8 = {                                                                                 \
+            [0] = (((((uint8_t)LOG_ENTRY_TYPE_RUN) & BITMASK_FOR_BITCOUNT(2)) << 6) /* type */    \
+                   | ((((uint8_t)((address) >> 16))) & BITMASK_FOR_BITCOUNT(3))     /* address */ \
+                   ),                                                                             \
+            [1] = (((uint8_t)((address) >> 8)) & BITMASK_FOR_BITCOUNT(8)), /* address */          \
+            [2] = (((uint8_t)(address)) & BITMASK_FOR_BITCOUNT(8)),        /* address */          \
+            [3] = ((uint8_t)(length)),                                     /* length */           \
+        }                                                                                         \
+    }
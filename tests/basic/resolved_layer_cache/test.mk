@@ -0,0 +1,13 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+# Re-run the basic suite with the resolved layer cache enabled, behaviour must not change
+SRC += \
+	../test_action_layer.cpp \
+	../test_keypress.cpp \
+	../test_one_shot_keys.cpp \
+	../test_tapping.cpp
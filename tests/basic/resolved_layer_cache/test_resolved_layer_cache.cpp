@@ -0,0 +1,74 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class ResolvedLayerCache : public TestFixture {};
+
+TEST_F(ResolvedLayerCache, FollowsLayerStateChanges) {
+    TestDriver driver;
+    KeymapKey  base_key  = KeymapKey{0, 0, 0, KC_A};
+    KeymapKey  upper_key = KeymapKey{1, 0, 0, KC_B};
+    KeymapKey  trans_key = KeymapKey{2, 0, 0, KC_TRNS};
+
+    set_keymap({base_key, upper_key, trans_key});
+
+    EXPECT_EQ(layer_switch_get_layer(base_key.position), 0);
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(base_key.position), 1);
+    layer_on(2);
+    EXPECT_EQ(layer_switch_get_layer(base_key.position), 1);
+    layer_off(1);
+    EXPECT_EQ(layer_switch_get_layer(base_key.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ResolvedLayerCache, FollowsDirectLayerStateWrites) {
+    TestDriver driver;
+    KeymapKey  base_key  = KeymapKey{0, 0, 0, KC_A};
+    KeymapKey  upper_key = KeymapKey{1, 0, 0, KC_B};
+
+    set_keymap({base_key, upper_key});
+
+    EXPECT_EQ(layer_switch_get_layer(base_key.position), 0);
+
+    /* Split keyboards sync the layer state without going through the setters. */
+    layer_state = 0b10;
+    EXPECT_EQ(layer_switch_get_layer(base_key.position), 1);
+    layer_state = 0;
+    EXPECT_EQ(layer_switch_get_layer(base_key.position), 0);
+
+    default_layer_state = 0b10;
+    EXPECT_EQ(layer_switch_get_layer(base_key.position), 1);
+    default_layer_state = 0b01;
+    EXPECT_EQ(layer_switch_get_layer(base_key.position), 0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ResolvedLayerCache, FollowsKeymapChanges) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  base_key  = KeymapKey{0, 0, 0, KC_A};
+    KeymapKey  trans_key = KeymapKey{1, 0, 0, KC_TRNS};
+    KeymapKey  upper_key = KeymapKey{1, 0, 0, KC_B};
+
+    set_keymap({base_key, trans_key});
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(base_key.position), 0);
+
+    /* Rewriting the keymap must drop previously resolved layers. */
+    set_keymap({base_key, upper_key});
+    EXPECT_EQ(layer_switch_get_layer(base_key.position), 1);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(base_key);
+
+    VERIFY_AND_CLEAR(driver);
+}
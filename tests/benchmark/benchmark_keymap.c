@@ -0,0 +1,52 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// Feature tables for the benchmark keymap, sized like a typical user keymap so each handler has real work to do.
+
+const uint16_t PROGMEM jk_combo[]       = {KC_J, KC_K, COMBO_END};
+const uint16_t PROGMEM sd_combo[]       = {KC_S, KC_D, COMBO_END};
+const uint16_t PROGMEM we_combo[]       = {KC_W, KC_E, COMBO_END};
+const uint16_t PROGMEM xc_combo[]       = {KC_X, KC_C, COMBO_END};
+const uint16_t PROGMEM cv_combo[]       = {KC_C, KC_V, COMBO_END};
+const uint16_t PROGMEM mcomm_combo[]    = {KC_M, KC_COMM, COMBO_END};
+const uint16_t PROGMEM commdot_combo[]  = {KC_COMM, KC_DOT, COMBO_END};
+const uint16_t PROGMEM fg_combo[]       = {KC_F, KC_G, COMBO_END};
+const uint16_t PROGMEM hj_combo[]       = {KC_H, KC_J, COMBO_END};
+const uint16_t PROGMEM qw_combo[]       = {KC_Q, KC_W, COMBO_END};
+const uint16_t PROGMEM op_combo[]       = {KC_O, KC_P, COMBO_END};
+const uint16_t PROGMEM sdf_combo[]      = {KC_S, KC_D, KC_F, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(jk_combo, KC_ESC),
+    COMBO(sd_combo, KC_TAB),
+    COMBO(we_combo, KC_LBRC),
+    COMBO(xc_combo, KC_RBRC),
+    COMBO(cv_combo, KC_MINS),
+    COMBO(mcomm_combo, KC_EQL),
+    COMBO(commdot_combo, KC_SCLN),
+    COMBO(fg_combo, KC_GRV),
+    COMBO(hj_combo, KC_BSLS),
+    COMBO(qw_combo, KC_1),
+    COMBO(op_combo, KC_0),
+    COMBO(sdf_combo, KC_DEL),
+};
+// clang-format on
+
+tap_dance_action_t tap_dance_actions[] = {
+    ACTION_TAP_DANCE_DOUBLE(KC_SPC, KC_ENT),
+};
+
+const key_override_t delete_override    = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t semicolon_override = ko_make_basic(MOD_MASK_SHIFT, KC_COMM, KC_SCLN);
+const key_override_t colon_override     = ko_make_basic(MOD_MASK_SHIFT, KC_DOT, S(KC_SCLN));
+const key_override_t escape_override    = ko_make_basic(MOD_MASK_CTRL, KC_QUOT, KC_ESC);
+
+const key_override_t *key_overrides[] = {
+    &delete_override,
+    &semicolon_override,
+    &colon_override,
+    &escape_override,
+};
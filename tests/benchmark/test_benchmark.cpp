@@ -0,0 +1,285 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+/* Counts heap allocations by interposing the C allocator, which libstdc++ also allocates through. */
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__)
+#    define BENCHMARK_COUNT_ALLOCATIONS
+
+static bool     count_allocations = false;
+static uint32_t allocations       = 0;
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+
+void *malloc(size_t size) noexcept {
+    allocations += count_allocations;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) noexcept {
+    allocations += count_allocations;
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) noexcept {
+    allocations += count_allocations;
+    return __libc_realloc(ptr, size);
+}
+}
+#endif
+
+/* A host driver that swallows reports, so that gmock bookkeeping stays out of the measurement. */
+static uint32_t reports_sent = 0;
+
+static uint8_t bench_keyboard_leds(void) {
+    return 0;
+}
+static void bench_send_keyboard(report_keyboard_t *report) {
+    reports_sent++;
+}
+static void bench_send_nkro(report_nkro_t *report) {
+    reports_sent++;
+}
+static void bench_send_mouse(report_mouse_t *report) {}
+static void bench_send_extra(report_extra_t *report) {}
+
+static host_driver_t bench_driver = {bench_keyboard_leds, bench_send_keyboard, bench_send_nkro, bench_send_mouse, bench_send_extra};
+
+struct TraceEvent {
+    uint32_t   time;
+    keyevent_t event;
+};
+
+/* MAKE_KEYEVENT() uses C designated initialisers, which C++ only accepts in declaration order. */
+static keyevent_t key_event(keypos_t key, bool pressed) {
+    keyevent_t event = {};
+    event.key        = key;
+    event.pressed    = pressed;
+    event.type       = KEY_EVENT;
+    return event;
+}
+
+// clang-format off
+static const char typed_text[] =
+    "The quick brown fox jumps over the lazy dog, then the five boxing wizards jump quickly. "
+    "Pack my box with five dozen liquor jugs. Sphinx of black quartz, judge my vow. "
+    "I thier was fales, teh\b\bhe cosnt fitler is choosen becuase it is ture. "
+    "How vexingly quick daft zebras jump, said Jack's friend, who'd typed it twice.";
+
+static const uint16_t benchmark_keymap[MATRIX_ROWS][MATRIX_COLS] = {
+    {KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I,    KC_O,   KC_P},
+    {KC_A, KC_S, KC_D, KC_F, KC_G, KC_H, KC_J, KC_K,    KC_L,   KC_QUOT},
+    {KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N, KC_M, KC_COMM, KC_DOT, KC_SLSH},
+    {KC_LSFT, TD(0),  KC_BSPC, KC_ENT, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_RSFT},
+};
+// clang-format on
+
+/* Every feature is compiled in, and each run switches on only the ones it measures. */
+enum BenchmarkFeature : uint8_t {
+    BENCHMARK_COMBO        = 1 << 0,
+    BENCHMARK_TAP_DANCE    = 1 << 1,
+    BENCHMARK_KEY_OVERRIDE = 1 << 2,
+    BENCHMARK_AUTOCORRECT  = 1 << 3,
+    BENCHMARK_AUTO_SHIFT   = 1 << 4,
+    BENCHMARK_CAPS_WORD    = 1 << 5,
+    BENCHMARK_ALL_FEATURES = 0x3F,
+};
+
+struct BenchmarkParams {
+    std::string name;
+    uint8_t     features;
+};
+
+class Benchmark : public TestFixture, public testing::WithParamInterface<BenchmarkParams> {
+   protected:
+    std::vector<TraceEvent> trace;
+    uint8_t                 features;
+
+    void SetUp() override {
+        features = GetParam().features;
+
+        set_keymap({});
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                uint16_t keycode = benchmark_keymap[row][col];
+                if (keycode == TD(0) && !(features & BENCHMARK_TAP_DANCE)) {
+                    keycode = KC_SPC;
+                }
+                if (keycode != KC_NO) {
+                    add_key(KeymapKey(0, col, row, keycode));
+                }
+            }
+        }
+
+        features & BENCHMARK_COMBO ? combo_enable() : combo_disable();
+        features & BENCHMARK_KEY_OVERRIDE ? key_override_on() : key_override_off();
+        features & BENCHMARK_AUTOCORRECT ? autocorrect_enable() : autocorrect_disable();
+        features & BENCHMARK_AUTO_SHIFT ? autoshift_enable() : autoshift_disable();
+        record_trace();
+    }
+
+    bool position_of(uint16_t keycode, keypos_t *key) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                if (benchmark_keymap[row][col] == keycode) {
+                    key->row = row;
+                    key->col = col;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /* Turns the text into key events with human-like timing, including rolls where the next key goes down before the
+     * previous one is released. A fixed seed keeps every run identical. */
+    void record_trace() {
+        uint32_t seed = 0x2545F491;
+        auto     next = [&seed](uint32_t range) {
+            seed = seed * 1103515245 + 12345;
+            return (seed >> 16) % range;
+        };
+
+        uint32_t now = 0;
+        for (const char *c = typed_text; *c; c++) {
+            uint16_t keycode;
+            bool     shifted = false;
+            if (*c >= 'a' && *c <= 'z') {
+                keycode = KC_A + (*c - 'a');
+            } else if (*c >= 'A' && *c <= 'Z') {
+                keycode = KC_A + (*c - 'A');
+                shifted = true;
+            } else {
+                switch (*c) {
+                    case ' ':
+                        keycode = benchmark_keymap[3][1];
+                        break;
+                    case '\b':
+                        keycode = KC_BSPC;
+                        break;
+                    case ',':
+                        keycode = KC_COMM;
+                        break;
+                    case '.':
+                        keycode = KC_DOT;
+                        break;
+                    default:
+                        keycode = KC_QUOT;
+                        break;
+                }
+            }
+
+            keypos_t key, shift;
+            ASSERT_TRUE(position_of(keycode, &key));
+            ASSERT_TRUE(position_of(KC_LSFT, &shift));
+            uint32_t hold = 60 + next(50);
+            if (shifted) {
+                trace.push_back({now, key_event(shift, true)});
+                now += 30 + next(30);
+            }
+            trace.push_back({now, key_event(key, true)});
+            trace.push_back({now + hold, key_event(key, false)});
+            if (shifted) {
+                trace.push_back({now + hold + 10, key_event(shift, false)});
+            }
+            now += 40 + next(100);
+        }
+        std::stable_sort(trace.begin(), trace.end(), [](const TraceEvent &a, const TraceEvent &b) { return a.time < b.time; });
+    }
+
+    /* Feeds the trace through action_exec(), running the main loop whenever time passes so timeouts fire as usual.
+     * Returns the time spent inside action_exec(), which is where the process_record chain runs. */
+    std::chrono::nanoseconds replay() {
+        std::chrono::nanoseconds spent(0);
+        uint32_t                 now = 0;
+        for (const TraceEvent &e : trace) {
+            if (e.time != now) {
+                advance_time(e.time - now);
+                keyboard_task();
+                now = e.time;
+            }
+            keyevent_t event = e.event;
+            event.time       = timer_read();
+            if ((features & BENCHMARK_CAPS_WORD) && !is_caps_word_on()) {
+                // Keep Caps Word active, since it only does work while it is on
+                caps_word_on();
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            action_exec(event);
+            spent += std::chrono::steady_clock::now() - start;
+        }
+        advance_time(TAPPING_TERM * 2);
+        keyboard_task();
+        return spent;
+    }
+
+    /* Replays the trace once to warm up, then measures repeated replays and checks that none of them allocate. */
+    void run_benchmark() {
+        const int iterations = 20;
+
+        host_set_driver(&bench_driver);
+        reports_sent = 0;
+        replay();
+        EXPECT_GT(reports_sent, trace.size() / 2);
+
+#ifdef BENCHMARK_COUNT_ALLOCATIONS
+        allocations       = 0;
+        count_allocations = true;
+#endif
+        std::chrono::nanoseconds elapsed(0);
+        for (int n = 0; n < iterations; n++) {
+            elapsed += replay();
+        }
+#ifdef BENCHMARK_COUNT_ALLOCATIONS
+        count_allocations = false;
+        EXPECT_EQ(allocations, 0) << "the keycode processing chain allocated on the heap";
+#endif
+
+        std::cout << "process_record chain [" << GetParam().name << "]: " << elapsed.count() / (iterations * trace.size()) << "ns/event over " << trace.size() << " events" << std::endl;
+    }
+};
+
+// clang-format off
+INSTANTIATE_TEST_CASE_P(
+    FeatureSets,
+    Benchmark,
+    ::testing::Values(
+        BenchmarkParams{"Baseline", 0},
+        BenchmarkParams{"Combo", BENCHMARK_COMBO},
+        BenchmarkParams{"TapDance", BENCHMARK_TAP_DANCE},
+        BenchmarkParams{"KeyOverride", BENCHMARK_KEY_OVERRIDE},
+        BenchmarkParams{"Autocorrect", BENCHMARK_AUTOCORRECT},
+        BenchmarkParams{"AutoShift", BENCHMARK_AUTO_SHIFT},
+        BenchmarkParams{"CapsWord", BENCHMARK_CAPS_WORD},
+        BenchmarkParams{"AllFeatures", BENCHMARK_ALL_FEATURES}
+    ),
+    [](const ::testing::TestParamInfo<BenchmarkParams>& info) {
+        return info.param.name;
+    }
+);
+// clang-format on
+
+TEST_P(Benchmark, ReplayTypingTrace) {
+    run_benchmark();
+}
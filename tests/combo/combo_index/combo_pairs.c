@@ -0,0 +1,50 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+#include "keymap_introspection.h"
+
+/* A combo for every pair of F1-F24, served between the second and third combos of test_combos_index.c. Pair combos
+ * produce consecutive keycodes from KC_A onwards, wrapping every 26, in the order they are generated. */
+
+#define F_KEY_COUNT 24
+#define PAIR_COMBO_COUNT (F_KEY_COUNT * (F_KEY_COUNT - 1) / 2)
+
+static uint16_t pair_keys[PAIR_COMBO_COUNT][3];
+static combo_t  pair_combos[PAIR_COMBO_COUNT];
+
+static uint16_t f_key(uint8_t i) {
+    /* F13-F24 are not contiguous with F1-F12 in the HID usage table. */
+    return i < 12 ? KC_F1 + i : KC_F13 + (i - 12);
+}
+
+static void init_pair_combos(void) {
+    static bool initialised = false;
+    if (initialised) return;
+    initialised = true;
+
+    uint16_t n = 0;
+    for (uint8_t a = 0; a < F_KEY_COUNT; a++) {
+        for (uint8_t b = a + 1; b < F_KEY_COUNT; b++, n++) {
+            pair_keys[n][0] = f_key(a);
+            pair_keys[n][1] = f_key(b);
+            pair_keys[n][2] = COMBO_END;
+            pair_combos[n]  = (combo_t)COMBO(pair_keys[n], KC_A + n % 26);
+        }
+    }
+}
+
+uint16_t combo_count(void) {
+    init_pair_combos();
+    return combo_count_raw() + PAIR_COMBO_COUNT;
+}
+
+combo_t *combo_get(uint16_t combo_idx) {
+    init_pair_combos();
+    if (combo_idx < 2) {
+        return combo_get_raw(combo_idx);
+    }
+    if (combo_idx < 2 + PAIR_COMBO_COUNT) {
+        return &pair_combos[combo_idx - 2];
+    }
+    return combo_get_raw(combo_idx - PAIR_COMBO_COUNT);
+}
@@ -0,0 +1,100 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "quantum.h"
+#include "keycode.h"
+#include "test_common.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class ComboIndex : public TestFixture {
+   protected:
+    std::vector<KeymapKey> f_keys;
+
+    void SetUp() override {
+        /* F1-F24 fill rows 1 to 3 of the test matrix. */
+        for (uint8_t i = 0; i < 24; i++) {
+            /* F13-F24 are not contiguous with F1-F12 in the HID usage table. */
+            uint16_t keycode = i < 12 ? KC_F1 + i : KC_F13 + (i - 12);
+            f_keys.emplace_back(0, i % MATRIX_COLS, 1 + i / MATRIX_COLS, keycode);
+        }
+        set_keymap({});
+        for (auto &key : f_keys) {
+            add_key(key);
+        }
+    }
+
+    /* The keycode produced by the combo of F<i+1> and F<j+1>, see test_combos_index.c. */
+    static uint16_t pair_keycode(uint8_t i, uint8_t j) {
+        uint16_t n = 0;
+        for (uint8_t a = 0; a < 24; a++) {
+            for (uint8_t b = a + 1; b < 24; b++, n++) {
+                if (a == i && b == j) {
+                    return KC_A + n % 26;
+                }
+            }
+        }
+        return KC_NO;
+    }
+};
+
+TEST_F(ComboIndex, EveryPairFiresItsOwnCombo) {
+    TestDriver driver;
+    InSequence s;
+
+    for (uint8_t i = 0; i < 24; i++) {
+        for (uint8_t j = i + 1; j < 24; j++) {
+            if (i == 0 && j < 3) {
+                /* F1+F2 and F1+F3 are covered by the overlap test below. */
+                continue;
+            }
+            EXPECT_REPORT(driver, (pair_keycode(i, j)));
+            EXPECT_EMPTY_REPORT(driver);
+            tap_combo({f_keys[i], f_keys[j]});
+            VERIFY_AND_CLEAR(driver);
+        }
+    }
+}
+
+TEST_F(ComboIndex, PairFiresWhenPressedInReverse) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (pair_keycode(4, 19)));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({f_keys[19], f_keys[4]});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, LongestOverlappingComboWins) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({f_keys[0], f_keys[1], f_keys[2]});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (pair_keycode(0, 1)));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({f_keys[0], f_keys[1]}, COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, KeyInManyCombosTapsThroughAlone) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_F7));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(f_keys[6]);
+    idle_for(COMBO_TERM);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,18 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+/* The two combos from the parent directory, so its tests run unchanged against the index, followed by a combo for
+ * every pair of F1-F24 and a three key combo overlapping F1+F2. The pair combos are generated in combo_pairs.c. */
+
+uint16_t const modtest_combo[]  = {KC_Y, KC_U, COMBO_END};
+uint16_t const osmshift_combo[] = {KC_Z, KC_X, COMBO_END};
+uint16_t const f1_f2_f3_combo[] = {KC_F1, KC_F2, KC_F3, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(modtest_combo, RSFT_T(KC_SPACE)),
+    COMBO(osmshift_combo, OSM(MOD_LSFT)),
+    COMBO(f1_f2_f3_combo, KC_ENTER),
+};
+// clang-format on
@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DYNAMIC_KEYMAP_RAM_CACHE
+#define DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY 100
+#define DYNAMIC_KEYMAP_LAYER_COUNT 2
+#define EEPROM_SIZE 1024
+#define SENDSTRING_ASYNC
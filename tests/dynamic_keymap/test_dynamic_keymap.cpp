@@ -0,0 +1,112 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class DynamicKeymapRamCache : public TestFixture {
+   protected:
+    /* Reads a keycode straight from EEPROM, bypassing the RAM mirror. */
+    uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+        uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+    }
+};
+
+TEST_F(DynamicKeymapRamCache, WritesAreServedFromRamAndFlushedLater) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_set_keycode(1, 2, 3, KC_A);
+    dynamic_keymap_flush();
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), KC_A);
+
+    dynamic_keymap_set_keycode(1, 2, 3, KC_B);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), KC_B);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), KC_A);
+    EXPECT_TRUE(dynamic_keymap_flush_pending());
+
+    /* Each write restarts the flush delay. */
+    idle_for(DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY / 2);
+    dynamic_keymap_set_keycode(1, 2, 4, KC_C);
+    idle_for(DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY / 2 + 1);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), KC_A);
+
+    idle_for(DYNAMIC_KEYMAP_RAM_CACHE_FLUSH_DELAY);
+    EXPECT_FALSE(dynamic_keymap_flush_pending());
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), KC_B);
+    EXPECT_EQ(eeprom_keycode(1, 2, 4), KC_C);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapRamCache, BufferAccessIsCoherentWithKeycodeAccess) {
+    TestDriver driver;
+    uint8_t    data[4];
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_set_keycode(0, 0, 0, KC_D);
+    dynamic_keymap_set_keycode(0, 0, 1, KC_E);
+    dynamic_keymap_get_buffer(0, sizeof(data), data);
+    EXPECT_EQ((data[0] << 8) | data[1], KC_D);
+    EXPECT_EQ((data[2] << 8) | data[3], KC_E);
+
+    uint8_t upload[] = {0x00, KC_F, 0x00, KC_G};
+    dynamic_keymap_set_buffer(0, sizeof(upload), upload);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), KC_F);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), KC_G);
+
+    dynamic_keymap_flush();
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), KC_F);
+    EXPECT_EQ(eeprom_keycode(0, 0, 1), KC_G);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapRamCache, ResetIsWrittenThroughImmediately) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_set_keycode(0, 1, 1, KC_H);
+    dynamic_keymap_reset();
+    EXPECT_FALSE(dynamic_keymap_flush_pending());
+    EXPECT_EQ(eeprom_keycode(0, 1, 1), dynamic_keymap_get_keycode(0, 1, 1));
+    VERIFY_AND_CLEAR(driver);
+}
+
+class DynamicKeymapMacro : public TestFixture {
+   protected:
+    void TearDown() override {
+        send_string_async_cancel();
+        TestFixture::TearDown();
+    }
+};
+
+TEST_F(DynamicKeymapMacro, MacroIsQueuedAndCancelledByBufferWrites) {
+    TestDriver driver;
+    InSequence s;
+    uint8_t    macros[] = {'a', 0, 'b', 0};
+
+    dynamic_keymap_macro_reset();
+    dynamic_keymap_macro_set_buffer(0, sizeof(macros), macros);
+
+    /* Sending returns straight away, and the macro is typed by the following scans. */
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(1);
+    EXPECT_TRUE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(3);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    /* Rewriting the macro buffer abandons anything still queued. */
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(0);
+    dynamic_keymap_macro_set_buffer(0, sizeof(macros), macros);
+    EXPECT_FALSE(send_string_async_busy());
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define IDLE_SCHEDULER_MAX_SLEEP_MS 10
+#define IDLE_SCHEDULER_ACTIVE_TIMEOUT 100
@@ -0,0 +1,175 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+void     simulate_wakeup_event_in(uint32_t ms);
+uint32_t last_idle_sleep(void);
+}
+
+using testing::_;
+
+class IdleScheduler : public TestFixture {
+   protected:
+    void SetUp() override {
+        set_activity_timestamps(0, 0, 0);
+    }
+
+    void TearDown() override {
+        /* Service every outstanding deadline so that none of them leak into the next test. */
+        TestDriver driver;
+        EXPECT_NO_REPORT(driver);
+        idle_for(IDLE_SCHEDULER_ACTIVE_TIMEOUT);
+        run_main_loop();
+        run_main_loop();
+        VERIFY_AND_CLEAR(driver);
+    }
+
+    /* Runs one iteration of the main loop, including the idle sleep. */
+    void run_main_loop() {
+        keyboard_task();
+        deferred_exec_task();
+        housekeeping_task();
+        idle_scheduler_task();
+    }
+
+    /* Waits out the active window so that the scheduler is allowed to sleep, then lets it start a fresh iteration. */
+    void settle() {
+        idle_for(IDLE_SCHEDULER_ACTIVE_TIMEOUT);
+        idle_scheduler_task();
+    }
+};
+
+static uint32_t noop_callback(uint32_t trigger_time, void *cb_arg) {
+    return 0;
+}
+
+TEST_F(IdleScheduler, SleepsForMaximumWhenIdle) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    EXPECT_EQ(idle_scheduler_sleep_duration(), IDLE_SCHEDULER_MAX_SLEEP_MS);
+
+    uint32_t before = timer_read32();
+    run_main_loop();
+    EXPECT_EQ(last_idle_sleep(), IDLE_SCHEDULER_MAX_SLEEP_MS);
+    EXPECT_EQ(timer_elapsed32(before), IDLE_SCHEDULER_MAX_SLEEP_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleScheduler, StaysAwakeWhileKeyHeldAndAfterActivity) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    settle();
+
+    /* Press key: scanning must keep running for as long as the key is held. */
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    settle();
+    EXPECT_EQ(idle_scheduler_sleep_duration(), 0);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release key: the loop stays awake for the active window. */
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    EXPECT_EQ(idle_scheduler_sleep_duration(), 0);
+    idle_for(IDLE_SCHEDULER_ACTIVE_TIMEOUT - 2);
+    EXPECT_EQ(idle_scheduler_sleep_duration(), 0);
+    run_one_scan_loop();
+    EXPECT_EQ(idle_scheduler_sleep_duration(), IDLE_SCHEDULER_MAX_SLEEP_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleScheduler, RequestedDeadlineShortensSleep) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    idle_scheduler_request_wakeup_in(3);
+    idle_scheduler_request_wakeup_in(7);
+    EXPECT_EQ(idle_scheduler_sleep_duration(), 3);
+
+    run_main_loop();
+    EXPECT_EQ(last_idle_sleep(), 3);
+
+    /* The loop runs once at the first deadline, then sleeps until the second one. */
+    EXPECT_EQ(idle_scheduler_sleep_duration(), 0);
+    run_main_loop();
+    EXPECT_EQ(last_idle_sleep(), 4);
+
+    /* Once every deadline has been serviced the loop goes back to sleeping for the maximum. */
+    EXPECT_EQ(idle_scheduler_sleep_duration(), 0);
+    run_main_loop();
+    EXPECT_EQ(idle_scheduler_sleep_duration(), IDLE_SCHEDULER_MAX_SLEEP_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleScheduler, LaterRequestDoesNotReplaceEarlierDeadline) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    idle_scheduler_request_wakeup_in(6);
+    idle_scheduler_request_wakeup_in(2);
+    idle_scheduler_request_wakeup_in(6);
+    EXPECT_EQ(idle_scheduler_sleep_duration(), 2);
+
+    run_main_loop();
+    EXPECT_EQ(last_idle_sleep(), 2);
+    run_main_loop();
+    EXPECT_EQ(last_idle_sleep(), 4);
+    run_main_loop();
+    EXPECT_EQ(last_idle_sleep(), IDLE_SCHEDULER_MAX_SLEEP_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleScheduler, DeferredExecutorDeadlineShortensSleep) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    deferred_token token = defer_exec(4, noop_callback, NULL);
+    EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(idle_scheduler_sleep_duration(), 4);
+
+    run_main_loop();
+    EXPECT_EQ(last_idle_sleep(), 4);
+    cancel_deferred_exec(token);
+    run_main_loop();
+    EXPECT_EQ(idle_scheduler_sleep_duration(), IDLE_SCHEDULER_MAX_SLEEP_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleScheduler, WakeupEventEndsSleepEarly) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    simulate_wakeup_event_in(2);
+    run_main_loop();
+    EXPECT_EQ(last_idle_sleep(), 2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleScheduler, WakeupFromIsrForcesAnIteration) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    settle();
+    idle_scheduler_wakeup_from_isr();
+    EXPECT_EQ(idle_scheduler_sleep_duration(), 0);
+
+    run_main_loop();
+    EXPECT_EQ(idle_scheduler_sleep_duration(), IDLE_SCHEDULER_MAX_SLEEP_MS);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,111 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LatencyTrace : public TestFixture {};
+
+static const uint8_t all_stages = (1 << LATENCY_STAGE_MATRIX) | (1 << LATENCY_STAGE_DEBOUNCE) | (1 << LATENCY_STAGE_ACTION) | (1 << LATENCY_STAGE_RELEASE) | (1 << LATENCY_STAGE_REPORT);
+
+TEST_F(LatencyTrace, PlainKeyIsReportedWithinTheSameScan) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_EQ(latency_trace_count(), 2);
+    latency_trace_t trace;
+    latency_trace_get(0, &trace);
+    EXPECT_EQ(trace.key.row, 0);
+    EXPECT_EQ(trace.key.col, 1);
+    EXPECT_TRUE(trace.pressed);
+    EXPECT_EQ(trace.stamped, all_stages);
+    latency_trace_get(1, &trace);
+    EXPECT_FALSE(trace.pressed);
+    EXPECT_EQ(trace.stamped, all_stages);
+
+    EXPECT_EQ(latency_trace_histogram(LATENCY_TRACE_TOTAL)[0], 2);
+    EXPECT_EQ(latency_trace_histogram(LATENCY_STAGE_REPORT)[0], 2);
+    EXPECT_EQ(latency_trace_dropped(), 0);
+    EXPECT_LATENCY_BUDGET(LATENCY_STAGE_REPORT, 0);
+}
+
+TEST_F(LatencyTrace, TappingBufferDelaysRelease) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 1, 0, SFT_T(KC_A));
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key, 20);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The press is held by the tapping buffer until the key is released 20ms later. */
+    ASSERT_EQ(latency_trace_count(), 2);
+    latency_trace_t trace;
+    latency_trace_get(0, &trace);
+    EXPECT_TRUE(trace.pressed);
+    EXPECT_EQ(trace.stamped, all_stages);
+    EXPECT_EQ(trace.time[LATENCY_STAGE_ACTION] - trace.time[LATENCY_STAGE_MATRIX], 0);
+    EXPECT_EQ(trace.time[LATENCY_STAGE_RELEASE] - trace.time[LATENCY_STAGE_ACTION], 20);
+    EXPECT_EQ(latency_trace_histogram(LATENCY_STAGE_RELEASE)[5], 1);
+    EXPECT_EQ(latency_trace_histogram(LATENCY_TRACE_TOTAL)[5], 1);
+
+    EXPECT_LATENCY_BUDGET(LATENCY_STAGE_REPORT, TAPPING_TERM);
+}
+
+TEST_F(LatencyTrace, EventWithoutReportCompletesWithoutReportStage) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 1, 0, MO(1));
+
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_EQ(latency_trace_count(), 2);
+    latency_trace_t trace;
+    latency_trace_get(0, &trace);
+    EXPECT_EQ(trace.stamped, all_stages & ~(1 << LATENCY_STAGE_REPORT));
+    EXPECT_EQ(latency_trace_histogram(LATENCY_STAGE_REPORT)[0], 0);
+    EXPECT_EQ(latency_trace_histogram(LATENCY_TRACE_TOTAL)[0], 2);
+}
+
+TEST_F(LatencyTrace, RingBufferKeepsNewestTraces) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 1, 0, KC_A);
+    auto       key_b = KeymapKey(0, 2, 0, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    EXPECT_ANY_REPORT(driver).Times(20);
+    for (uint8_t i = 0; i < 9; i++) {
+        tap_key(key_a);
+    }
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_EQ(latency_trace_count(), LATENCY_TRACE_BUFFER_SIZE);
+    latency_trace_t trace;
+    latency_trace_get(LATENCY_TRACE_BUFFER_SIZE - 2, &trace);
+    EXPECT_EQ(trace.key.col, 2);
+    EXPECT_TRUE(trace.pressed);
+    EXPECT_FALSE(latency_trace_get(LATENCY_TRACE_BUFFER_SIZE, &trace));
+    EXPECT_EQ(latency_trace_histogram(LATENCY_TRACE_TOTAL)[0], 20);
+}
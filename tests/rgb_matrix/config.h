@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGB_MATRIX_LED_COUNT 120
+#define RGB_MATRIX_KEYPRESSES
+#define RGB_MATRIX_HIT_DISTANCE_CACHE
+#define ENABLE_RGB_MATRIX_SOLID_MULTISPLASH
+
+#define EEPROM_SIZE 1024
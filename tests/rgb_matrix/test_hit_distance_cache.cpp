@@ -0,0 +1,155 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "lib/lib8tion/lib8tion.h"
+
+typedef hsv_t (*reactive_splash_f)(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
+
+rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv);
+hsv_t SOLID_SPLASH_math(hsv_t hsv, int16_t dx, int16_t dy, uint8_t dist, uint16_t tick);
+bool  effect_runner_reactive_splash(uint8_t start, effect_params_t* params, reactive_splash_f effect_func);
+
+led_config_t g_led_config;
+
+static rgb_t leds[RGB_MATRIX_LED_COUNT];
+
+static void test_init(void) {}
+static void test_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    leds[index] = (rgb_t){.r = r, .g = g, .b = b};
+}
+static void test_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        test_set_color(i, r, g, b);
+    }
+}
+static void test_flush(void) {}
+
+extern const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = test_init,
+    .set_color     = test_set_color,
+    .set_color_all = test_set_color_all,
+    .flush         = test_flush,
+};
+}
+
+class HitDistanceCache : public TestFixture {
+   protected:
+    void SetUp() override {
+        memset(&g_led_config, NO_LED, sizeof(g_led_config.matrix_co));
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            g_led_config.point[i] = (led_point_t){.x = (uint8_t)((i % 15) * 16), .y = (uint8_t)((i / 15) * 9)};
+            g_led_config.flags[i] = LED_FLAG_KEYLIGHT;
+        }
+        rgb_matrix_hit_distance_cache_clear();
+        g_last_hit_tracker.count = 0;
+    }
+
+    void add_hit(uint8_t led, uint16_t tick) {
+        uint8_t j                   = g_last_hit_tracker.count++;
+        g_last_hit_tracker.x[j]     = g_led_config.point[led].x;
+        g_last_hit_tracker.y[j]     = g_led_config.point[led].y;
+        g_last_hit_tracker.index[j] = led;
+        g_last_hit_tracker.tick[j]  = tick;
+    }
+
+    /* Renders a whole frame, in RGB_MATRIX_LED_PROCESS_LIMIT sized chunks like rgb_matrix_task() does. */
+    void render_frame() {
+        effect_params_t params = {0, LED_FLAG_ALL, false};
+        while (effect_runner_reactive_splash(0, &params, &SOLID_SPLASH_math)) {
+            params.iter++;
+        }
+    }
+
+    /* The value every LED should have, worked out the way the runner did before distances were cached. */
+    void expect_uncached_frame() {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            hsv_t hsv = rgb_matrix_config.hsv;
+            hsv.v     = 0;
+            for (uint8_t j = 0; j < g_last_hit_tracker.count; j++) {
+                int16_t  dx   = g_led_config.point[i].x - g_last_hit_tracker.x[j];
+                int16_t  dy   = g_led_config.point[i].y - g_last_hit_tracker.y[j];
+                uint8_t  dist = sqrt16(dx * dx + dy * dy);
+                uint16_t tick = scale16by8(g_last_hit_tracker.tick[j], qadd8(rgb_matrix_config.speed, 1));
+                hsv           = SOLID_SPLASH_math(hsv, dx, dy, dist, tick);
+            }
+            hsv.v     = scale8(hsv.v, rgb_matrix_config.hsv.v);
+            rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
+            EXPECT_EQ(leds[i].r, rgb.r) << "LED " << +i;
+            EXPECT_EQ(leds[i].g, rgb.g) << "LED " << +i;
+            EXPECT_EQ(leds[i].b, rgb.b) << "LED " << +i;
+        }
+    }
+};
+
+TEST_F(HitDistanceCache, CachedFramesMatchUncachedRendering) {
+    rgb_matrix_config.hsv   = (hsv_t){0, 255, 255};
+    rgb_matrix_config.speed = 127;
+    add_hit(7, 40);
+    add_hit(63, 100);
+    add_hit(7, 150);
+
+    /* First frame fills the cache, second frame is served entirely from it. */
+    render_frame();
+    expect_uncached_frame();
+    render_frame();
+    expect_uncached_frame();
+
+    uint8_t* row = rgb_matrix_hit_distances(63);
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx = g_led_config.point[i].x - g_led_config.point[63].x;
+        int16_t dy = g_led_config.point[i].y - g_led_config.point[63].y;
+        EXPECT_EQ(row[i], sqrt16(dx * dx + dy * dy)) << "LED " << +i;
+    }
+}
+
+TEST_F(HitDistanceCache, RowsAreRecycledOnlyForForgottenHits) {
+    rgb_matrix_config.hsv   = (hsv_t){0, 255, 255};
+    rgb_matrix_config.speed = 127;
+
+    /* Keep hitting new keys well past LED_HITS_TO_REMEMBER, dropping the oldest hit each time. */
+    for (uint8_t led = 0; led < 3 * LED_HITS_TO_REMEMBER; led++) {
+        if (g_last_hit_tracker.count == LED_HITS_TO_REMEMBER) {
+            memmove(&g_last_hit_tracker.x[0], &g_last_hit_tracker.x[1], LED_HITS_TO_REMEMBER - 1);
+            memmove(&g_last_hit_tracker.y[0], &g_last_hit_tracker.y[1], LED_HITS_TO_REMEMBER - 1);
+            memmove(&g_last_hit_tracker.index[0], &g_last_hit_tracker.index[1], LED_HITS_TO_REMEMBER - 1);
+            memmove(&g_last_hit_tracker.tick[0], &g_last_hit_tracker.tick[1], (LED_HITS_TO_REMEMBER - 1) * 2);
+            g_last_hit_tracker.count--;
+        }
+        add_hit(led * 5, 20 * led);
+        render_frame();
+        expect_uncached_frame();
+    }
+}
+
+TEST_F(HitDistanceCache, Benchmark) {
+    const int iterations    = 200;
+    rgb_matrix_config.hsv   = (hsv_t){0, 255, 255};
+    rgb_matrix_config.speed = 127;
+    for (uint8_t j = 0; j < LED_HITS_TO_REMEMBER; j++) {
+        add_hit(j * 13, 10 * j);
+    }
+
+    /* Clearing the cache before every frame recalculates every distance, which is what the runner used to do. */
+    auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < iterations; n++) {
+        rgb_matrix_hit_distance_cache_clear();
+        render_frame();
+    }
+    auto uncached = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int n = 0; n < iterations; n++) {
+        render_frame();
+    }
+    auto cached = std::chrono::steady_clock::now() - start;
+    expect_uncached_frame();
+
+    std::cout << "reactive splash frame, " << RGB_MATRIX_LED_COUNT << " LEDs x " << LED_HITS_TO_REMEMBER << " hits: " << std::chrono::duration_cast<std::chrono::nanoseconds>(uncached).count() / iterations << "ns uncached, " << std::chrono::duration_cast<std::chrono::nanoseconds>(cached).count() / iterations << "ns cached" << std::endl;
+}
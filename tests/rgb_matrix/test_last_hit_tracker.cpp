@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+using testing::_;
+
+class LastHitTracker : public TestFixture {
+   protected:
+    void SetUp() override {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                g_led_config.matrix_co[row][col] = row * MATRIX_COLS + col;
+            }
+        }
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            g_led_config.point[i] = (led_point_t){.x = (uint8_t)((i % 15) * 16), .y = (uint8_t)((i / 15) * 9)};
+            g_led_config.flags[i] = LED_FLAG_KEYLIGHT;
+        }
+        rgb_matrix_init();
+    }
+
+    /* Presses one key per millisecond, starting at LED `first`. */
+    void hit_keys(uint8_t first, uint8_t count) {
+        for (uint8_t led = first; led < first + count; led++) {
+            rgb_matrix_handle_key_event(led / MATRIX_COLS, led % MATRIX_COLS, true);
+            idle_for(1);
+        }
+    }
+};
+
+TEST_F(LastHitTracker, SnapshotIsOldestFirstWithDerivedTicks) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    hit_keys(0, 3);
+    idle_for(2 * RGB_MATRIX_LED_FLUSH_LIMIT);
+
+    ASSERT_EQ(g_last_hit_tracker.count, 3);
+    for (uint8_t j = 0; j < 3; j++) {
+        EXPECT_EQ(g_last_hit_tracker.index[j], j);
+        EXPECT_EQ(g_last_hit_tracker.x[j], g_led_config.point[j].x);
+        EXPECT_EQ(g_last_hit_tracker.y[j], g_led_config.point[j].y);
+    }
+    EXPECT_EQ(g_last_hit_tracker.tick[0] - g_last_hit_tracker.tick[1], 1);
+    EXPECT_EQ(g_last_hit_tracker.tick[1] - g_last_hit_tracker.tick[2], 1);
+}
+
+TEST_F(LastHitTracker, OverflowKeepsMostRecentHits) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    hit_keys(0, LED_HITS_TO_REMEMBER + 5);
+    idle_for(2 * RGB_MATRIX_LED_FLUSH_LIMIT);
+
+    ASSERT_EQ(g_last_hit_tracker.count, LED_HITS_TO_REMEMBER);
+    for (uint8_t j = 0; j < LED_HITS_TO_REMEMBER; j++) {
+        EXPECT_EQ(g_last_hit_tracker.index[j], j + 5);
+    }
+    for (uint8_t j = 1; j < LED_HITS_TO_REMEMBER; j++) {
+        EXPECT_EQ(g_last_hit_tracker.tick[j - 1] - g_last_hit_tracker.tick[j], 1);
+    }
+}
+
+TEST_F(LastHitTracker, HitsExpireOldestFirst) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    hit_keys(0, 2);
+    idle_for(UINT16_MAX - 2 * RGB_MATRIX_LED_FLUSH_LIMIT);
+    hit_keys(2, 1);
+    idle_for(4 * RGB_MATRIX_LED_FLUSH_LIMIT);
+
+    ASSERT_EQ(g_last_hit_tracker.count, 1);
+    EXPECT_EQ(g_last_hit_tracker.index[0], 2);
+
+    idle_for(UINT16_MAX);
+    EXPECT_EQ(g_last_hit_tracker.count, 0);
+}
@@ -0,0 +1,158 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class SendStringAsync : public TestFixture {
+   protected:
+    void TearDown() override {
+        send_string_async_cancel();
+        TestFixture::TearDown();
+    }
+};
+
+TEST_F(SendStringAsync, SendsOneReportPerScan) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_async("aB"));
+    EXPECT_TRUE(send_string_async_busy());
+
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_B));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(4);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, KeepsScanningWhileSending) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, KC_Z);
+
+    set_keymap({key});
+    EXPECT_TRUE(send_string_async("aa"));
+
+    /* The matrix is scanned in the same iteration as the first queued key event. */
+    EXPECT_REPORT(driver, (KC_Z));
+    EXPECT_REPORT(driver, (KC_Z, KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(3);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, HandlesTapAndDelayEscapes) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_async(SS_TAP(X_HOME) SS_DELAY(50) "a"));
+
+    EXPECT_REPORT(driver, (KC_HOME));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Nothing is sent until the delay has elapsed, but the queue is still busy. */
+    EXPECT_NO_REPORT(driver);
+    idle_for(50);
+    EXPECT_TRUE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, CancelReleasesHeldModifiers) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_async("Hello"));
+    EXPECT_TRUE(send_string_async("world"));
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_H));
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_async_cancel();
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, CancelReleasesKeysHeldByEarlierSteps) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_TRUE(send_string_async(SS_DOWN(X_LSFT) "ab" SS_UP(X_LSFT)));
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    idle_for(3);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The shift was pressed by an earlier escape sequence, not by the character being typed. */
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_async_cancel();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, RejectsStringsWhenQueueIsFull) {
+    TestDriver driver;
+
+    EXPECT_TRUE(send_string_async("a"));
+    EXPECT_TRUE(send_string_async("b"));
+    EXPECT_FALSE(send_string_async("c"));
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver).Times(2);
+    idle_for(5);
+    EXPECT_FALSE(send_string_async_busy());
+    VERIFY_AND_CLEAR(driver);
+}
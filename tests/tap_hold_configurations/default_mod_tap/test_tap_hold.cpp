@@ -224,3 +224,48 @@ TEST_F(DefaultTapHold, tap_and_hold_mod_tap_hold_key) {
     run_one_scan_loop();
     VERIFY_AND_CLEAR(driver);
 }
+
+TEST_F(DefaultTapHold, waiting_buffer_overflow_settles_mod_tap_key_as_held) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_hold_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    auto       key_a            = KeymapKey(0, 2, 0, KC_A);
+    auto       key_b            = KeymapKey(0, 3, 0, KC_B);
+    auto       key_c            = KeymapKey(0, 4, 0, KC_C);
+    auto       key_d            = KeymapKey(0, 5, 0, KC_D);
+
+    set_keymap({mod_tap_hold_key, key_a, key_b, key_c, key_d});
+
+    /* Press mod-tap-hold key. */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_hold_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Tap regular keys until the waiting buffer is full. */
+    EXPECT_NO_REPORT(driver);
+    tap_keys(key_a, key_b, key_c);
+    key_d.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The next event settles the mod-tap-hold key as held, no event is dropped. */
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_B));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_C));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_D));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    key_d.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release mod-tap-hold key. */
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -17,6 +17,9 @@
 #include "matrix.h"
 #include "test_matrix.h"
 #include <string.h>
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 
 static matrix_row_t matrix[MATRIX_ROWS] = {};
 
@@ -26,6 +29,9 @@ void matrix_init(void) {
 }
 
 uint8_t matrix_scan(void) {
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_raw_matrix(matrix, 0, MATRIX_ROWS);
+#endif
     matrix_scan_kb();
     return 1;
 }
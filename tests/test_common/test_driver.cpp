@@ -16,6 +16,12 @@
 
 #include "test_driver.hpp"
 
+#ifdef LATENCY_TRACE_ENABLE
+extern "C" {
+#    include "latency_trace.h"
+}
+#endif
+
 TestDriver* TestDriver::m_this = nullptr;
 
 namespace {
@@ -34,6 +40,9 @@ uint8_t hex_digit_to_keycode(uint8_t digit) {
 TestDriver::TestDriver() : m_driver{&TestDriver::keyboard_leds, &TestDriver::send_keyboard, &TestDriver::send_nkro, &TestDriver::send_mouse, &TestDriver::send_extra} {
     host_set_driver(&m_driver);
     m_this = this;
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_clear();
+#endif
 }
 
 TestDriver::~TestDriver() {
@@ -87,4 +96,26 @@ void expect_unicode_code_point(TestDriver& driver, uint32_t code_point) {
     EXPECT_REPORT(driver, (KC_SPACE));
     EXPECT_EMPTY_REPORT(driver);
 }
+
+void expect_latency_budget(uint8_t stage, uint32_t budget) {
+#ifdef LATENCY_TRACE_ENABLE
+    EXPECT_GT(latency_trace_count(), 0) << "no key events were traced";
+    for (uint8_t i = 0; i < latency_trace_count(); i++) {
+        latency_trace_t trace;
+        latency_trace_get(i, &trace);
+
+        uint8_t first = 0;
+        while (first < LATENCY_STAGE_COUNT && !(trace.stamped & (1 << first))) {
+            first++;
+        }
+        EXPECT_TRUE(trace.stamped & (1 << stage)) << "key event (" << +trace.key.row << ", " << +trace.key.col << ") " << (trace.pressed ? "press" : "release") << " never reached stage " << +stage;
+        if (trace.stamped & (1 << stage)) {
+            EXPECT_LE(trace.time[stage] - trace.time[first], budget) << "key event (" << +trace.key.row << ", " << +trace.key.col << ") " << (trace.pressed ? "press" : "release") << " exceeded the latency budget of stage " << +stage;
+        }
+    }
+    latency_trace_clear();
+#else
+    ADD_FAILURE() << "EXPECT_LATENCY_BUDGET requires LATENCY_TRACE_ENABLE";
+#endif
+}
 } // namespace internal
@@ -160,6 +160,17 @@ MATCHER_P(KeycodeEq, expected_keycode, "is equal to " + testing::PrintToString(e
  */
 #define VERIFY_AND_CLEAR(driver) testing::Mock::VerifyAndClearExpectations(&driver)
 
+/**
+ * @brief Checks that every key event traced since the previous check reached
+ * pipeline `stage` no later than `budget` milliseconds after it was first seen,
+ * then discards the traces. Requires LATENCY_TRACE_ENABLE. For instance,
+ *
+ *   // Expect every key event to produce a report within the scan it was detected in.
+ *   EXPECT_LATENCY_BUDGET(LATENCY_STAGE_REPORT, 0);
+ */
+#define EXPECT_LATENCY_BUDGET(stage, budget) internal::expect_latency_budget((stage), (budget))
+
 namespace internal {
 void expect_unicode_code_point(TestDriver& driver, uint32_t code_point);
+void expect_latency_budget(uint8_t stage, uint32_t budget);
 } // namespace internal
@@ -104,6 +104,7 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+    layer_cache_invalidate();
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -131,13 +132,14 @@ void TestFixture::tap_combo(const std::vector<KeymapKey>& chord_keys, unsigned d
 
 void TestFixture::set_keymap(std::initializer_list<KeymapKey> keys) {
     this->keymap.clear();
+    layer_cache_invalidate();
     for (auto& key : keys) {
         add_key(key);
     }
 }
 
 const KeymapKey* TestFixture::find_key(layer_t layer, keypos_t position) const {
-    auto keymap_key_predicate = [&](KeymapKey candidate) { return candidate.layer == layer && candidate.position.col == position.col && candidate.position.row == position.row; };
+    auto keymap_key_predicate = [&](const KeymapKey& candidate) { return candidate.layer == layer && candidate.position.col == position.col && candidate.position.row == position.row; };
 
     auto result = std::find_if(this->keymap.begin(), this->keymap.end(), keymap_key_predicate);
 